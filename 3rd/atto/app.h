@@ -153,6 +153,21 @@ struct AAppState {
 /* hide cursor, pin mouse to window center and report only delta */
 void aAppGrabInput(int grab);
 
+typedef enum {
+	/* paint() as fast as possible, or at vsync rate (default) */
+	AAUM_Continuous,
+	/* paint() only after input, resize, expose or aAppRequestRedraw();
+	 * interval_us, if nonzero, is the longest time to wait between paints */
+	AAUM_WaitEvents,
+	/* paint() every interval_us, sleeping in between */
+	AAUM_Paced,
+} AAppUpdateMode;
+
+/* Only X11 honors this for now, other platforms keep painting continuously */
+void aAppSetUpdateMode(AAppUpdateMode mode, ATimeUs interval_us);
+/* Ask for one more paint() in AAUM_WaitEvents mode; safe to call from paint() */
+void aAppRequestRedraw(void);
+
 extern const struct AAppState *a_app_state;
 
 struct AAppProctable {
@@ -59,7 +59,7 @@
  *   - compressed
  *   - mipmaps
  *   - download
- *   - partial upload
+ *   + partial upload
  *   - RAII
  * - functionality
  *   - copy between buffers/textures
@@ -141,6 +141,9 @@ typedef struct {
 enum AGLTextureUpdateFlags {
 	// Available only in GLES2+ and GL3+
 	AGLTUF_GenerateMipmaps = (1 << 0),
+	// Write only the given region of the texture, never resize it. Without this flag
+	// an update with pixels starting at the origin re-specifies the texture to the region size
+	AGLTUF_SubRegion = (1 << 1),
 };
 
 typedef struct {
@@ -149,15 +152,31 @@ typedef struct {
 	int x, y, z, width, height, depth;
 	uint32_t flags; // Combination of AGLTextureUpdateFlags
 	const void *pixels;
+	// Row length of pixels in texels if the region is cut from a larger image, 0 = width (GL or GLES3)
+	int stride;
 } AGLTextureData;
 
 AGLTexture aGLTextureCreate(const AGLTextureData *data);
+/* Updates that keep the texture's size and format write into it in place */
 void aGLTextureUpdate(AGLTexture *texture, const AGLTextureData *data);
-#define aGLTextureDestroy(t) \
-	do { \
-		glDeleteTextures(1, &(t)->_.name); \
-		(t)->_.name = 0; \
-	} while (0)
+
+/* Streaming upload: fill the returned memory with size bytes of pixels, then call
+ * aGLTextureStageEnd, which uploads them like aGLTextureUpdate (data->pixels is ignored).
+ * On desktop GL the memory is a mapped pixel unpack buffer from a ring of
+ * ATTO_GL_UPLOAD_RING_SIZE, so the driver copies into the texture asynchronously
+ * instead of from client memory; elsewhere it is a scratch buffer. One stage at a time. */
+void *aGLTextureStageBegin(size_t size);
+void aGLTextureStageEnd(AGLTexture *texture, const AGLTextureData *data);
+
+typedef struct {
+	AGLTexture *texture;
+	AGLTextureData data;
+} AGLTextureUpdateItem;
+
+/* Applies the updates in order. Consecutive items for the same texture (tiles, array
+ * layers) bind it once and generate its mipmaps once, after the last of them */
+void aGLTextureUpdateBatch(const AGLTextureUpdateItem *items, int count);
+void aGLTextureDestroy(AGLTexture *texture);
 
 /* Shader programs */
 
@@ -429,6 +448,7 @@ extern char a_gl_error[];
 		X(PFNGLGETSHADERIVPROC, glGetShaderiv) \
 		X(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation) \
 		X(PFNGLLINKPROGRAMPROC, glLinkProgram) \
+		X(PFNGLMAPBUFFERPROC, glMapBuffer) \
 		X(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage) \
 		X(PFNGLSHADERSOURCEPROC, glShaderSource) \
 		X(PFNGLTEXIMAGE3DPROC, glTexImage3D) \
@@ -449,6 +469,7 @@ extern char a_gl_error[];
 		X(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv) \
 		X(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv) \
 		X(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv) \
+		X(PFNGLUNMAPBUFFERPROC, glUnmapBuffer) \
 		X(PFNGLUSEPROGRAMPROC, glUseProgram) \
 		X(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer) \
 
@@ -552,6 +573,20 @@ char a_gl_error[ATTO_GL_ERROR_BUFFER_SIZE];
 	#define ATTO_GL_MAX_ATTRIBS 8
 #endif
 
+#ifndef ATTO_GL_MAX_TEXTURE_UNITS
+	#define ATTO_GL_MAX_TEXTURE_UNITS 16
+#endif
+
+#ifndef ATTO_GL_UPLOAD_RING_SIZE
+	#define ATTO_GL_UPLOAD_RING_SIZE 3
+#endif
+
+#if defined(GL_PIXEL_UNPACK_BUFFER) && defined(ATTO_GL_DESKTOP)
+	#define ATTO__GL_UNPACK_BUFFER
+#else
+	#include <stdlib.h> /* realloc() */
+#endif
+
 typedef struct {
 	unsigned int vertices;
 	unsigned int triangles;
@@ -579,12 +614,32 @@ static struct {
 		unsigned x, y, w, h;
 	} viewport;
 
+	struct {
+		GLint unit;
+		/* texture name bound to each unit, per AGLTextureType - 1 */
+		GLuint bound[ATTO_GL_MAX_TEXTURE_UNITS][AGLTT_2DArray];
+		GLint unpack_row_length;
+	} texture;
+
+	struct {
+#ifdef ATTO__GL_UNPACK_BUFFER
+		GLuint buffers[ATTO_GL_UPLOAD_RING_SIZE];
+		GLsizeiptr sizes[ATTO_GL_UPLOAD_RING_SIZE];
+		int next;
+#else
+		void *scratch;
+		size_t scratch_size;
+#endif
+		int staging;
+	} upload;
+
 	AGLStats stats;
 } a__gl_state;
 
 static GLuint a__GLCreateShader(int type, const char *const *source);
 static void a__GLProgramBind(AGLProgram program, const AGLProgramUniform *uniforms, int nuniforms);
 static void a__GLTextureBind(const AGLTexture *texture, GLint unit);
+static void a__GLTextureBindUnit(AGLTextureType type, GLuint name, GLint unit);
 static void a__GLAttribsBind(const AGLAttribute *attrs, int nattrs);
 static void a__GLCullingBind(AGLCullMode cull, AGLFrontFace front);
 static void a__GLDepthBind(AGLDepthParams depth);
@@ -985,127 +1040,232 @@ static struct A__GLTextureFormat getTextureFormat(AGLTextureFormat aformat) {
 	return tf;
 }
 
-typedef void (a__gl_texture_upload_func)(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf);
+typedef void (a__gl_texture_upload_func)(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf, const void *pixels, int has_pixels);
 
-static void a__GLTexureUpload1D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf) {
+/* The texture is re-specified (reallocated) only if it has to grow, change format, or an update
+ * with pixels starting at the origin asks for a different size; everything else is a SubImage */
+static void a__GLTexureUpload1D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf, const void *pixels, int has_pixels) {
 	const int maxwidth = data->x + data->width;
 
+	const int at_origin = data->x == 0 && !(data->flags & AGLTUF_SubRegion);
+	const int resize = at_origin && has_pixels && maxwidth != tex->width;
 	const int expand = maxwidth > tex->width;
-	const int is_subimage = data->x > 0;
-	const void *const to_upload = (!is_subimage && data->pixels) ? data->pixels : NULL;
 
 	ATTO_ASSERT(binding == GL_TEXTURE_1D);
 
-	if (expand || to_upload) {
-		AGL__CALL(glTexImage1D(binding, 0, tf.internal, maxwidth, 0,
-			tf.format, tf.type, to_upload));
-		tex->width = maxwidth;
+	if (resize || expand || tex->format != data->format) {
+		const int width = (resize || expand) ? maxwidth : tex->width;
+		const int whole = at_origin && width == maxwidth;
+		AGL__CALL(glTexImage1D(binding, 0, tf.internal, width, 0,
+			tf.format, tf.type, (whole && has_pixels) ? pixels : NULL));
+		tex->width = width;
+		if (whole)
+			return;
 	}
 
-	if (is_subimage) {
-		ATTO_ASSERT(data->pixels);
+	if (has_pixels) {
 		AGL__CALL(glTexSubImage1D(binding, 0,
 			data->x, data->width,
-			tf.format, tf.type, data->pixels));
+			tf.format, tf.type, pixels));
 	}
 }
 
-static void a__GLTexureUpload2D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf) {
+static void a__GLTexureUpload2D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf, const void *pixels, int has_pixels) {
 	const int maxwidth = data->x + data->width;
 	const int maxheight = data->y + data->height;
 
+	const int at_origin = data->x == 0 && data->y == 0 && !(data->flags & AGLTUF_SubRegion);
+	const int resize = at_origin && has_pixels && (maxwidth != tex->width || maxheight != tex->height);
 	const int expand = (maxwidth > tex->width) || (maxheight > tex->height);
-	const int is_subimage = (data->x > 0 || data->y > 0);
-	const void *const to_upload = (!is_subimage && data->pixels) ? data->pixels : NULL;
 
 	ATTO_ASSERT(binding == GL_TEXTURE_2D);
 
-	if (expand || to_upload) {
-		AGL__CALL(glTexImage2D(binding, 0, tf.internal, maxwidth, maxheight, 0,
-			tf.format, tf.type, to_upload));
-		tex->width = maxwidth;
-		tex->height = maxheight;
+	if (resize || expand || tex->format != data->format) {
+		const int width = (resize || maxwidth > tex->width) ? maxwidth : tex->width;
+		const int height = (resize || maxheight > tex->height) ? maxheight : tex->height;
+		const int whole = at_origin && width == maxwidth && height == maxheight;
+		AGL__CALL(glTexImage2D(binding, 0, tf.internal, width, height, 0,
+			tf.format, tf.type, (whole && has_pixels) ? pixels : NULL));
+		tex->width = width;
+		tex->height = height;
+		if (whole)
+			return;
 	}
 
-	if (is_subimage) {
-		ATTO_ASSERT(data->pixels);
+	if (has_pixels) {
 		AGL__CALL(glTexSubImage2D(binding, 0,
 			data->x, data->y, data->width, data->height,
-			tf.format, tf.type, data->pixels));
+			tf.format, tf.type, pixels));
 	}
 }
 
-static void a__GLTexureUpload3D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf) {
+static void a__GLTexureUpload3D(AGLTexture *tex, const AGLTextureData *data, GLenum binding, struct A__GLTextureFormat tf, const void *pixels, int has_pixels) {
 	const int maxwidth = data->x + data->width;
 	const int maxheight = data->y + data->height;
 	const int maxdepth = data->z + data->depth;
 
+	const int at_origin = data->x == 0 && data->y == 0 && data->z == 0 && !(data->flags & AGLTUF_SubRegion);
+	const int resize = at_origin && has_pixels
+		&& (maxwidth != tex->width || maxheight != tex->height || maxdepth != tex->depth);
 	const int expand = (maxwidth > tex->width)
 		|| (maxheight > tex->height)
 		|| (maxdepth > tex->depth);
-	const int is_subimage = (data->x > 0 || data->y > 0 || data->z > 0);
-	const void *const to_upload = (!is_subimage && data->pixels) ? data->pixels : NULL;
 
 	ATTO_ASSERT(binding == GL_TEXTURE_3D || binding == GL_TEXTURE_2D_ARRAY);
 
-	if (expand || to_upload) {
+	if (resize || expand || tex->format != data->format) {
+		const int width = (resize || maxwidth > tex->width) ? maxwidth : tex->width;
+		const int height = (resize || maxheight > tex->height) ? maxheight : tex->height;
+		const int depth = (resize || maxdepth > tex->depth) ? maxdepth : tex->depth;
+		const int whole = at_origin && width == maxwidth && height == maxheight && depth == maxdepth;
 		AGL__CALL(glTexImage3D(binding, 0, tf.internal,
-			maxwidth, maxheight, maxdepth, 0,
+			width, height, depth, 0,
 			tf.format, tf.type,
-			to_upload));
-		tex->width = maxwidth;
-		tex->height = maxheight;
-		tex->depth = maxdepth;
+			(whole && has_pixels) ? pixels : NULL));
+		tex->width = width;
+		tex->height = height;
+		tex->depth = depth;
+		if (whole)
+			return;
 	}
 
-	if (is_subimage) {
-		ATTO_ASSERT(data->pixels);
+	if (has_pixels) {
 		AGL__CALL(glTexSubImage3D(binding, 0,
 			data->x, data->y, data->z, data->width, data->height, data->depth,
-			tf.format, tf.type, data->pixels));
+			tf.format, tf.type, pixels));
 	}
 }
 
-void aGLTextureUpdate(AGLTexture *tex, const AGLTextureData *data) {
+static GLenum a__GLTextureTarget(AGLTextureType type) {
+	switch (type) {
+		case AGLTT_1D: return GL_TEXTURE_1D;
+		case AGLTT_2D: return GL_TEXTURE_2D;
+		case AGLTT_3D: return GL_TEXTURE_3D;
+		case AGLTT_2DArray: return GL_TEXTURE_2D_ARRAY;
+		case AGLTT_NULL: break;
+	}
+	ATTO_ASSERT(!"Invalid texture type");
+	return 0;
+}
+
+static void a__GLUnpackRowLength(GLint row_length) {
+	if (row_length == a__gl_state.texture.unpack_row_length)
+		return;
+#ifdef GL_UNPACK_ROW_LENGTH
+	AGL__CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length));
+#else
+	ATTO_ASSERT(!"AGLTextureData.stride is not supported");
+#endif
+	a__gl_state.texture.unpack_row_length = row_length;
+}
+
+/* Uploads to the texture bound on the active unit; pixels may be an unpack buffer offset */
+static void a__GLTextureUpdate(AGLTexture *tex, const AGLTextureData *data, const void *pixels, int has_pixels, int generate_mipmaps) {
 	ATTO_ASSERT(data->type == tex->type);
 
 	struct A__GLTextureFormat tf = getTextureFormat(data->format);
 
 	a__gl_texture_upload_func *upload_func = NULL;
-	GLenum binding = 0;
 
 	switch (data->type) {
 		case AGLTT_1D:
 			upload_func = &a__GLTexureUpload1D;
-			binding = GL_TEXTURE_1D;
 			break;
 		case AGLTT_2D:
 			upload_func = &a__GLTexureUpload2D;
-			binding = GL_TEXTURE_2D;
 			break;
 		case AGLTT_3D:
-			upload_func = &a__GLTexureUpload3D;
-			binding = GL_TEXTURE_3D;
-			break;
 		case AGLTT_2DArray:
 			upload_func = &a__GLTexureUpload3D;
-			binding = GL_TEXTURE_2D_ARRAY;
 			break;
 		case AGLTT_NULL: ATTO_ASSERT(!"Invalid texture type");
 	}
 	ATTO_ASSERT(upload_func);
 
-	// TODO track bindings properly
-	AGL__CALL(glBindTexture(binding, tex->_.name));
+	const GLenum binding = a__GLTextureTarget(data->type);
+	a__GLTextureBindUnit(data->type, tex->_.name, a__gl_state.texture.unit);
+	a__GLUnpackRowLength(data->stride == data->width ? 0 : data->stride);
 
-	upload_func(tex, data, binding, tf);
+	upload_func(tex, data, binding, tf, pixels, has_pixels);
 
-	if (data->pixels && (data->flags & AGLTUF_GenerateMipmaps))
+	if (has_pixels && generate_mipmaps)
 		AGL__CALL(glGenerateMipmap(binding));
 
 	tex->format = data->format;
 }
 
+void aGLTextureUpdate(AGLTexture *tex, const AGLTextureData *data) {
+	a__GLTextureUpdate(tex, data, data->pixels, data->pixels != NULL, data->flags & AGLTUF_GenerateMipmaps);
+}
+
+void aGLTextureUpdateBatch(const AGLTextureUpdateItem *items, int count) {
+	int mipmaps = 0;
+	for (int i = 0; i < count; ++i) {
+		const AGLTextureUpdateItem *item = items + i;
+		const int last_of_texture = (i + 1 == count) || (items[i + 1].texture != item->texture);
+		mipmaps |= item->data.pixels && (item->data.flags & AGLTUF_GenerateMipmaps);
+		a__GLTextureUpdate(item->texture, &item->data, item->data.pixels, item->data.pixels != NULL, 0);
+		if (last_of_texture && mipmaps) {
+			AGL__CALL(glGenerateMipmap(a__GLTextureTarget(item->texture->type)));
+			mipmaps = 0;
+		}
+	}
+}
+
+void *aGLTextureStageBegin(size_t size) {
+	ATTO_ASSERT(!a__gl_state.upload.staging);
+	a__gl_state.upload.staging = 1;
+#ifdef ATTO__GL_UNPACK_BUFFER
+	const int slot = a__gl_state.upload.next;
+	if (!a__gl_state.upload.buffers[slot])
+		AGL__CALL(glGenBuffers(1, a__gl_state.upload.buffers + slot));
+
+	AGL__CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, a__gl_state.upload.buffers[slot]));
+	/* No orphaning: the slot was last read ATTO_GL_UPLOAD_RING_SIZE - 1 uploads ago and
+	 * is normally idle, and reallocating it every frame costs more than the rare wait */
+	if ((GLsizeiptr)size > a__gl_state.upload.sizes[slot]) {
+		AGL__CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_DRAW));
+		a__gl_state.upload.sizes[slot] = (GLsizeiptr)size;
+	}
+	void *ptr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+	/* Client memory uploads must not see the unpack buffer until aGLTextureStageEnd */
+	AGL__CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	ATTO_ASSERT(ptr);
+	return ptr;
+#else
+	if (size > a__gl_state.upload.scratch_size) {
+		a__gl_state.upload.scratch = realloc(a__gl_state.upload.scratch, size);
+		ATTO_ASSERT(a__gl_state.upload.scratch);
+		a__gl_state.upload.scratch_size = size;
+	}
+	return a__gl_state.upload.scratch;
+#endif
+}
+
+void aGLTextureStageEnd(AGLTexture *tex, const AGLTextureData *data) {
+	ATTO_ASSERT(a__gl_state.upload.staging);
+	a__gl_state.upload.staging = 0;
+#ifdef ATTO__GL_UNPACK_BUFFER
+	AGL__CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, a__gl_state.upload.buffers[a__gl_state.upload.next]));
+	AGL__CALL(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+	a__GLTextureUpdate(tex, data, (const void *)0, 1, data->flags & AGLTUF_GenerateMipmaps);
+	AGL__CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	a__gl_state.upload.next = (a__gl_state.upload.next + 1) % ATTO_GL_UPLOAD_RING_SIZE;
+#else
+	a__GLTextureUpdate(tex, data, a__gl_state.upload.scratch, 1, data->flags & AGLTUF_GenerateMipmaps);
+#endif
+}
+
+void aGLTextureDestroy(AGLTexture *tex) {
+	/* GL unbinds deleted textures and may hand out the name again */
+	for (int unit = 0; unit < ATTO_GL_MAX_TEXTURE_UNITS; ++unit)
+		for (int type = 0; type < AGLTT_2DArray; ++type)
+			if (a__gl_state.texture.bound[unit][type] == tex->_.name)
+				a__gl_state.texture.bound[unit][type] = 0;
+	glDeleteTextures(1, &tex->_.name);
+	tex->_.name = 0;
+}
+
 AGLBuffer aGLBufferCreate(AGLBufferType type) {
 	AGLBuffer buf;
 	AGL__CALL(glGenBuffers(1, &buf.name));
@@ -1223,26 +1383,41 @@ static void a__GLTargetBind(const AGLDrawTarget *target) {
 	ATTO_GL_PROFILE_FUNC(__FUNCTION__, aAppTime() - start);
 }
 
+static void a__GLTextureBindUnit(AGLTextureType type, GLuint name, GLint unit) {
+	ATTO_ASSERT(unit < ATTO_GL_MAX_TEXTURE_UNITS);
+	if (a__gl_state.texture.unit != unit) {
+		AGL__CALL(glActiveTexture(GL_TEXTURE0 + unit));
+		a__gl_state.texture.unit = unit;
+	}
+
+	GLuint *bound = &a__gl_state.texture.bound[unit][type - 1];
+	if (*bound != name) {
+		AGL__CALL(glBindTexture(a__GLTextureTarget(type), name));
+		*bound = name;
+	}
+}
+
 static void a__GLTextureBind(const AGLTexture *texture, GLint unit) {
 	ATTO_GL_PROFILE_START
-	AGL__CALL(glActiveTexture(GL_TEXTURE0 + unit));
-	AGL__CALL(glBindTexture(GL_TEXTURE_2D, texture->_.name));
+	const AGLTextureType type = texture->type != AGLTT_NULL ? texture->type : AGLTT_2D;
+	const GLenum target = a__GLTextureTarget(type);
+	a__GLTextureBindUnit(type, texture->_.name, unit);
 
 	AGLTexture *mutable_texture = (AGLTexture *)texture;
 	if (mutable_texture->_.min_filter != (GLenum)mutable_texture->min_filter) {
-		AGL__CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mutable_texture->min_filter));
+		AGL__CALL(glTexParameteri(target, GL_TEXTURE_MIN_FILTER, mutable_texture->min_filter));
 		mutable_texture->_.min_filter = (GLenum)mutable_texture->min_filter;
 	}
 	if (mutable_texture->_.mag_filter != (GLenum)mutable_texture->mag_filter) {
-		AGL__CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mutable_texture->mag_filter));
+		AGL__CALL(glTexParameteri(target, GL_TEXTURE_MAG_FILTER, mutable_texture->mag_filter));
 		mutable_texture->_.mag_filter = (GLenum)mutable_texture->mag_filter;
 	}
 	if (mutable_texture->_.wrap_s != (GLenum)mutable_texture->wrap_s) {
-		AGL__CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, mutable_texture->wrap_s));
+		AGL__CALL(glTexParameteri(target, GL_TEXTURE_WRAP_S, mutable_texture->wrap_s));
 		mutable_texture->_.wrap_s = (GLenum)mutable_texture->wrap_s;
 	}
 	if (mutable_texture->_.wrap_t != (GLenum)mutable_texture->wrap_t) {
-		AGL__CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, mutable_texture->wrap_t));
+		AGL__CALL(glTexParameteri(target, GL_TEXTURE_WRAP_T, mutable_texture->wrap_t));
 		mutable_texture->_.wrap_t = (GLenum)mutable_texture->wrap_t;
 	}
 	ATTO_GL_PROFILE_END
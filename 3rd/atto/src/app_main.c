@@ -75,3 +75,11 @@ void aAppGrabInput(int grab) {
 	(void)grab;
 	ATTO_ASSERT(!"Not implemented");
 }
+
+void aAppSetUpdateMode(AAppUpdateMode mode, ATimeUs interval_us) {
+	(void)mode;
+	(void)interval_us;
+}
+
+void aAppRequestRedraw(void) {
+}
@@ -117,3 +117,12 @@ void aAppGrabInput(int grab) {
 	/* No-op. Input is always 'grabbed' on rpi */
 	a__global_state.grabbed = grab;
 }
+
+void aAppSetUpdateMode(AAppUpdateMode mode, ATimeUs interval_us) {
+	(void)mode;
+	(void)interval_us;
+	/* No-op. Always painting at display rate */
+}
+
+void aAppRequestRedraw(void) {
+}
@@ -688,3 +688,11 @@ void aAppGrabInput(int grab) {
 
 	a__app_state.grabbed = grab;
 }
+
+void aAppSetUpdateMode(AAppUpdateMode mode, ATimeUs interval_us) {
+	(void)mode;
+	(void)interval_us;
+}
+
+void aAppRequestRedraw(void) {
+}
@@ -34,6 +34,7 @@
 
 #include <string.h>
 #include <stdlib.h> /* exit() */
+#include <poll.h>
 
 static struct AAppState a__app_state;
 const struct AAppState *a_app_state = &a__app_state;
@@ -58,8 +59,71 @@ static struct {
 	AAppDisplay displays[A__X11_MAX_DISPLAYS];
 	int displays_count;
 #endif
+
+	AAppUpdateMode update_mode;
+	ATimeUs update_interval;
+	ATimeUs next_paint;
+	int redraw;
 } a__x11;
 
+void aAppSetUpdateMode(AAppUpdateMode mode, ATimeUs interval_us) {
+	a__x11.update_mode = mode;
+	a__x11.update_interval = interval_us;
+	a__x11.next_paint = aAppTime() + interval_us;
+	a__x11.redraw = 1;
+}
+
+void aAppRequestRedraw(void) {
+	a__x11.redraw = 1;
+}
+
+/* Returns nonzero if it is time to paint, otherwise blocks until either the X
+ * connection becomes readable or the next paint deadline passes, and returns 0 */
+static int a__x11WaitForPaint(void) {
+	int timeout_ms = -1, left;
+	struct pollfd pfd;
+
+	switch (a__x11.update_mode) {
+	case AAUM_Continuous:
+		return 1;
+
+	case AAUM_WaitEvents:
+		if (a__x11.redraw)
+			return 1;
+		if (!a__x11.update_interval)
+			break;
+		/* fallthrough */
+
+	case AAUM_Paced:
+		left = (int)(a__x11.next_paint - aAppTime());
+		if (left <= 0)
+			return 1;
+		/* Round up: waking up to 1ms late is fine as deadlines advance by a fixed interval,
+		 * rounding down would spin through the last fraction of a millisecond instead */
+		timeout_ms = (left + 999) / 1000;
+		break;
+	}
+
+	/* XPending() also flushes requests queued by paint() and event handlers,
+	 * which must reach the server before we go to sleep */
+	if (XPending(a__x11.display))
+		return 0;
+
+	pfd.fd = ConnectionNumber(a__x11.display);
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	poll(&pfd, 1, timeout_ms);
+	return 0;
+}
+
+static void a__x11SchedulePaint(ATimeUs now) {
+	a__x11.next_paint += a__x11.update_interval;
+
+	/* Fell behind by more than a frame, or waking up from idle: restart pacing from now */
+	if ((int)(a__x11.next_paint - now) <= 0)
+		a__x11.next_paint = now + a__x11.update_interval;
+}
+
 static void a__appProcessXKeyEvent(XEvent *e) {
 	ATimeUs timestamp = aAppTime();
 	AKey key = AK_Unknown;
@@ -415,7 +479,7 @@ static void createWindow(const XVisualInfo *vinfo, int x, int y, int w, int h, i
 	XMapWindow(a__x11.display, a__x11.window);
 
 	XSelectInput(a__x11.display, a__x11.window,
-		StructureNotifyMask | KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | PointerMotionMask);
+		StructureNotifyMask | ExposureMask | KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | PointerMotionMask);
 }
 
 int main(int argc, char *argv[]) {
@@ -527,10 +591,12 @@ int main(int argc, char *argv[]) {
 	if (a__app_proctable.resize)
 		a__app_proctable.resize(timestamp, 0, 0);
 
+	a__x11.redraw = 1;
 	for (;;) {
 		while (XPending(a__x11.display)) {
 			XEvent e;
 			XNextEvent(a__x11.display, &e);
+			a__x11.redraw = 1;
 			switch (e.type) {
 			case ConfigureNotify: {
 				unsigned int oldw = a__app_state.width, oldh = a__app_state.height;
@@ -549,7 +615,20 @@ int main(int argc, char *argv[]) {
 
 			case ButtonPress:
 			case ButtonRelease: a__appProcessXButton(&e); break;
-			case MotionNotify: a__appProcessXMotion(&e); break;
+			case MotionNotify:
+				/* Only the latest position of a motion burst matters: the deltas add up to the same thing.
+				 * Grabbed mode warps the pointer back on every event, so it has to see each one */
+				if (!a__app_state.grabbed) {
+					XEvent next;
+					while (XEventsQueued(a__x11.display, QueuedAfterReading)) {
+						XPeekEvent(a__x11.display, &next);
+						if (next.type != MotionNotify || next.xmotion.window != e.xmotion.window)
+							break;
+						XNextEvent(a__x11.display, &e);
+					}
+				}
+				a__appProcessXMotion(&e);
+				break;
 			case KeyPress:
 			case KeyRelease: a__appProcessXKeyEvent(&e); break;
 
@@ -559,6 +638,9 @@ int main(int argc, char *argv[]) {
 			}
 		}
 
+		if (!a__x11WaitForPaint())
+			continue;
+
 		{
 			ATimeUs now = aAppTime();
 			float dt;
@@ -566,6 +648,8 @@ int main(int argc, char *argv[]) {
 				last_paint = now;
 			dt = (now - last_paint) * 1e-6f;
 
+			/* Cleared before paint(), so that aAppRequestRedraw() from paint() schedules the next one */
+			a__x11.redraw = 0;
 			if (a__app_proctable.paint)
 				a__app_proctable.paint(now, dt);
 
@@ -575,6 +659,7 @@ int main(int argc, char *argv[]) {
 			ATTO_ASSERT(eglSwapBuffers(a_app_egl_display, a__app_egl.surface));
 #endif
 			last_paint = now;
+			a__x11SchedulePaint(now);
 		}
 	}
 
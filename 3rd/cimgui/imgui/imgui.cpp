@@ -2302,8 +2302,8 @@ const char* ImStrSkipBlank(const char* str)
 
 // We support stb_sprintf which is much faster (see: https://github.com/nothings/stb/blob/master/stb_sprintf.h)
 // You may set IMGUI_USE_STB_SPRINTF to use our default wrapper, or set IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
-// and setup the wrapper yourself. (FIXME-OPT: Some of our high-level operations such as ImGuiTextBuffer::appendfv() are
-// designed using two-passes worst case, which probably could be improved using the stbsp_vsprintfcb() function.)
+// and setup the wrapper yourself. (ImGuiTextBuffer::appendfv() formats straight into its spare capacity and only needs
+// a second pass when that overflows.)
 #ifdef IMGUI_USE_STB_SPRINTF
 #ifndef IMGUI_DISABLE_STB_SPRINTF_IMPLEMENTATION
 #define STB_SPRINTF_IMPLEMENTATION
@@ -2396,7 +2396,19 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+#define IM_CRC32C_U8(crc, v)    _mm_crc32_u8(crc, v)
+#define IM_CRC32C_U32(crc, v)   _mm_crc32_u32(crc, v)
+#if defined(__x86_64__) || defined(_M_X64)
+#define IM_CRC32C_U64(crc, v)   (ImU32)_mm_crc32_u64(crc, v)
+#endif
+#elif defined(IMGUI_ENABLE_ARM_CRC)
+#define IM_CRC32C_U8(crc, v)    __crc32cb(crc, v)
+#define IM_CRC32C_U32(crc, v)   __crc32cw(crc, v)
+#define IM_CRC32C_U64(crc, v)   __crc32cd(crc, v)
+#endif
+
+#ifndef IM_CRC32C_U8
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2445,28 +2457,71 @@ static const ImU32 GCrc32LookupTable[256] =
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// With SSE 4.2 or ARMv8 CRC32 instructions, data is hashed 8 bytes at a time with the same result as the lookup table.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IM_CRC32C_U8
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data < data_end)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
     return ~crc;
 #else
+#ifdef IM_CRC32C_U64
+    while (data + 8 <= data_end)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = IM_CRC32C_U64(crc, v);
+        data += 8;
+    }
+#endif
     while (data + 4 <= data_end)
     {
-        crc = _mm_crc32_u32(crc, *(ImU32*)data);
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = IM_CRC32C_U32(crc, v);
         data += 4;
     }
     while (data < data_end)
-        crc = _mm_crc32_u8(crc, *data++);
+        crc = IM_CRC32C_U8(crc, *data++);
     return ~crc;
 #endif
 }
 
+#ifdef IM_CRC32C_U64
+// Hash [data, data_end) with support for ###, 8 bytes at a time for words that don't contain a '#'
+static ImU32 ImHashStrRangeCrc32c(ImU32 crc, ImU32 seed, const unsigned char* data, const unsigned char* data_end)
+{
+    while (data < data_end)
+    {
+        if (data + 8 <= data_end)
+        {
+            ImU64 v;
+            memcpy(&v, data, 8);
+            const ImU64 x = v ^ 0x2323232323232323ULL; // '#' bytes become zero
+            if (((x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL) == 0)
+            {
+                crc = IM_CRC32C_U64(crc, v);
+                data += 8;
+                continue;
+            }
+        }
+        unsigned char c = *data++;
+        if (c == '#' && data + 2 <= data_end && data[0] == '#' && data[1] == '#')
+        {
+            crc = seed;
+            data += 2;
+            continue;
+        }
+        crc = IM_CRC32C_U8(crc, c);
+    }
+    return crc;
+}
+#endif
+
 // Zero-terminated string hash, with support for ### to reset back to seed value.
 // e.g. "label###id" outputs the same hash as "id" (and "label" is generally displayed by the UI functions)
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2475,7 +2530,13 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifdef IM_CRC32C_U64
+    // Zero-terminated strings are measured first: strlen() is vectorized and never reads past the terminator's page.
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    return ~ImHashStrRangeCrc32c(crc, seed, data, data + data_size);
+#else
+#ifndef IM_CRC32C_U8
     const ImU32* crc32_lut = GCrc32LookupTable;
 #endif
     if (data_size != 0)
@@ -2490,10 +2551,10 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
                 data_size -= 2;
                 continue;
             }
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IM_CRC32C_U8
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
 #else
-            crc = _mm_crc32_u8(crc, c);
+            crc = IM_CRC32C_U8(crc, c);
 #endif
         }
     }
@@ -2507,14 +2568,15 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
                 data += 2;
                 continue;
             }
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IM_CRC32C_U8
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
 #else
-            crc = _mm_crc32_u8(crc, c);
+            crc = IM_CRC32C_U8(crc, c);
 #endif
         }
     }
     return ~crc;
+#endif
 }
 
 // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -3191,30 +3253,134 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 }
 
 // Helper: Text buffer for logging/accumulating text
+// First pass formats directly into the spare capacity (grown geometrically so this almost always fits).
+// A result filling the whole space may have been truncated: only then we measure and format a second time.
+// This relies only on ImFormatStringV() clamping its output, so it also works with user-provided format functions.
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
     va_list args_copy;
     va_copy(args_copy, args);
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
-    if (len <= 0)
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+    const int min_spare = 256;
+    if (write_off + min_spare >= Buf.Capacity)
     {
+        int new_capacity = Buf.Capacity * 2;
+        Buf.reserve(write_off + min_spare > new_capacity ? write_off + min_spare : new_capacity);
+    }
+
+    const int spare = Buf.Capacity - write_off + 1;         // Including room for the zero-terminator
+    int len = ImFormatStringV(&Buf.Data[write_off - 1], (size_t)spare, fmt, args);
+    if (len < spare - 1)
+    {
+        if (len > 0)
+            Buf.resize(write_off + len);
         va_end(args_copy);
         return;
     }
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+    // Output may have been truncated: measure and try again
+    va_list args_copy2;
+    va_copy(args_copy2, args_copy);
+    len = ImFormatStringV(NULL, 0, fmt, args_copy);
+    va_end(args_copy);
+    if (len <= 0)
+    {
+        Buf.Data[write_off - 1] = 0;
+        va_end(args_copy2);
+        return;
+    }
+
     const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
+    if (needed_sz >= Buf.Capacity)
     {
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
 
     Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy2);
+    va_end(args_copy2);
+}
+
+// Write decimal digits of 'v' backward, ending at 'buf_end'. Return the first character.
+static char* ImGuiTextBuffer_WriteU64Backward(char* buf_end, ImU64 v)
+{
+    static const char digit_pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char* p = buf_end;
+    while (v >= 100)
+    {
+        const int pair = (int)(v % 100) * 2;
+        v /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    }
+    if (v >= 10)
+    {
+        *--p = digit_pairs[(int)v * 2 + 1];
+        *--p = digit_pairs[(int)v * 2];
+    }
+    else
+    {
+        *--p = (char)('0' + (int)v);
+    }
+    return p;
+}
+
+void ImGuiTextBuffer::appendi(ImS64 v)
+{
+    char buf[24];
+    char* buf_end = buf + IM_COUNTOF(buf);
+    char* p = ImGuiTextBuffer_WriteU64Backward(buf_end, (v < 0) ? (ImU64)0 - (ImU64)v : (ImU64)v);
+    if (v < 0)
+        *--p = '-';
+    append(p, buf_end);
+}
+
+// Scale to an integer and round it ourselves. The product carries less than 2^-13 of rounding error in the allowed range,
+// so anything not close to a rounding tie rounds the same way as the exact value, as printf() does.
+void ImGuiTextBuffer::appendd(double v, int decimals)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+    if (decimals >= 0 && decimals < IM_COUNTOF(pow10))
+    {
+        ImU64 v_bits;
+        memcpy(&v_bits, &v, sizeof(v));
+        const bool negative = (v_bits >> 63) != 0;          // Also true for -0.0, which printf() outputs as "-0.000"
+        const double scaled = (negative ? -v : v) * pow10[decimals];
+        if (scaled < 1099511627776.0)                        // 2^40, also fails for NaN and infinities
+        {
+            ImU64 n = (ImU64)scaled;
+            const double frac = scaled - (double)n;
+            if (frac < 0.499 || frac > 0.501)
+            {
+                if (frac > 0.5)
+                    n++;
+                char buf[48];
+                char* buf_end = buf + IM_COUNTOF(buf);
+                char* p = buf_end;
+                if (decimals > 0)
+                {
+                    ImU64 divisor = (ImU64)pow10[decimals];
+                    ImU64 frac_digits = n % divisor;
+                    n /= divisor;
+                    for (int i = 0; i < decimals; i++, frac_digits /= 10)
+                        *--p = (char)('0' + (int)(frac_digits % 10));
+                    *--p = '.';
+                }
+                p = ImGuiTextBuffer_WriteU64Backward(p, n);
+                if (negative)
+                    *--p = '-';
+                append(p, buf_end);
+                return;
+            }
+        }
+    }
+    appendf("%.*f", decimals, v);
 }
 
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -4206,6 +4372,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
     InputEventsNextEventId = 1;
 
+    WindowsFocusOrderDirtyFrom = INT_MAX;
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
     CurrentWindow = NULL;
@@ -4456,6 +4623,7 @@ void ImGui::Initialize()
     viewport->PlatformWindowCreated = true;
     viewport->Flags = ImGuiViewportFlags_OwnedByApp;
     g.Viewports.push_back(viewport);
+    g.ViewportsById.SetVoidPtr(viewport->ID, viewport);
     g.TempBuffer.resize(1024 * 3 + 1, 0);
     g.ViewportCreatedCount++;
     g.PlatformIO.Viewports.push_back(g.Viewports[0]);
@@ -4528,6 +4696,7 @@ void ImGui::Shutdown()
     // Clear everything else
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
+    g.WindowsFocusOrderDirtyFrom = INT_MAX;
     g.WindowsTempSortBuffer.clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
@@ -4548,6 +4717,7 @@ void ImGui::Shutdown()
 
     g.CurrentViewport = g.MouseViewport = g.MouseLastHoveredViewport = NULL;
     g.Viewports.clear_delete();
+    g.ViewportsById.Clear();
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
@@ -13436,12 +13606,19 @@ bool ImGui::IsWindowFocused(ImGuiFocusedFlags flags)
         return ref_window == cur_window;
 }
 
+// Reordering WindowsFocusOrder[] only moves pointers: the ->FocusOrder of shifted windows is refreshed here when first needed,
+// so e.g. many windows appearing and taking focus on the same frame don't each touch every other root window.
 static int ImGui::FindWindowFocusIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    IM_UNUSED(g);
-    int order = window->FocusOrder;
     IM_ASSERT(window->RootWindow == window); // No child window (not testing _ChildWindow because of docking)
+    if (window->FocusOrder >= g.WindowsFocusOrderDirtyFrom)
+    {
+        for (int n = g.WindowsFocusOrderDirtyFrom; n < g.WindowsFocusOrder.Size; n++)
+            g.WindowsFocusOrder[n]->FocusOrder = (short)n;
+        g.WindowsFocusOrderDirtyFrom = INT_MAX;
+    }
+    int order = window->FocusOrder;
     IM_ASSERT(g.WindowsFocusOrder[order] == window);
     return order;
 }
@@ -13460,10 +13637,9 @@ static void ImGui::UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_c
     }
     else if (!just_created && child_flag_changed && new_is_explicit_child)
     {
-        IM_ASSERT(g.WindowsFocusOrder[window->FocusOrder] == window);
-        for (int n = window->FocusOrder + 1; n < g.WindowsFocusOrder.Size; n++)
-            g.WindowsFocusOrder[n]->FocusOrder--;
-        g.WindowsFocusOrder.erase(g.WindowsFocusOrder.Data + window->FocusOrder);
+        const int order = FindWindowFocusIndex(window);
+        g.WindowsFocusOrder.erase(g.WindowsFocusOrder.Data + order);
+        g.WindowsFocusOrderDirtyFrom = ImMin(g.WindowsFocusOrderDirtyFrom, order);
         window->FocusOrder = -1;
     }
     window->IsExplicitChild = new_is_explicit_child;
@@ -13474,19 +13650,19 @@ void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(window == window->RootWindow);
 
-    const int cur_order = window->FocusOrder;
-    IM_ASSERT(g.WindowsFocusOrder[cur_order] == window);
     if (g.WindowsFocusOrder.back() == window)
         return;
 
+    // Locate without refreshing stale indices (see FindWindowFocusIndex()): a stale window can only be at or after WindowsFocusOrderDirtyFrom.
+    int cur_order = window->FocusOrder;
+    if (cur_order >= g.WindowsFocusOrderDirtyFrom)
+        for (cur_order = g.WindowsFocusOrderDirtyFrom; g.WindowsFocusOrder[cur_order] != window; cur_order++) {}
+    IM_ASSERT(g.WindowsFocusOrder[cur_order] == window);
+
     const int new_order = g.WindowsFocusOrder.Size - 1;
-    for (int n = cur_order; n < new_order; n++)
-    {
-        g.WindowsFocusOrder[n] = g.WindowsFocusOrder[n + 1];
-        g.WindowsFocusOrder[n]->FocusOrder--;
-        IM_ASSERT(g.WindowsFocusOrder[n]->FocusOrder == n);
-    }
+    memmove(&g.WindowsFocusOrder[cur_order], &g.WindowsFocusOrder[cur_order + 1], (size_t)(new_order - cur_order) * sizeof(ImGuiWindow*));
     g.WindowsFocusOrder[new_order] = window;
+    g.WindowsFocusOrderDirtyFrom = ImMin(g.WindowsFocusOrderDirtyFrom, cur_order);
     window->FocusOrder = (short)new_order;
 }
 
@@ -16479,10 +16655,19 @@ ImGuiViewport* ImGui::GetMainViewport()
 ImGuiViewport* ImGui::FindViewportByID(ImGuiID viewport_id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiViewportP* viewport : g.Viewports)
-        if (viewport->ID == viewport_id)
-            return viewport;
-    return NULL;
+    ImGuiViewportP* viewport = (ImGuiViewportP*)g.ViewportsById.GetVoidPtr(viewport_id);
+    IM_ASSERT(viewport == NULL || viewport->ID == viewport_id);
+    return viewport;
+}
+
+// Viewports change ID when their ownership is transferred to another window (e.g. a dock node host window)
+static void SetViewportID(ImGuiViewportP* viewport, ImGuiID id)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.ViewportsById.GetVoidPtr(viewport->ID) == viewport)
+        g.ViewportsById.SetVoidPtr(viewport->ID, NULL);
+    viewport->ID = id;
+    g.ViewportsById.SetVoidPtr(id, viewport);
 }
 
 ImGuiViewport* ImGui::FindViewportByPlatformHandle(void* platform_handle)
@@ -16755,19 +16940,37 @@ static void ImGui::UpdateViewportsNewFrame()
     g.CurrentDpiScale = 0.0f;
     g.CurrentViewport = NULL;
     g.MouseViewport = NULL;
+
+    // Erase unused viewports
+    // Clear references to them in windows in a single pass (window->ViewportId becomes the master data). The main viewport was just marked active above.
+    int viewports_to_destroy = 0;
+    for (ImGuiViewportP* viewport : g.Viewports)
+        if (viewport->LastFrameActive < g.FrameCount - 2)
+            viewports_to_destroy++;
+    if (viewports_to_destroy > 0)
+    {
+        for (ImGuiWindow* window : g.Windows)
+            if (window->Viewport != NULL && window->Viewport->LastFrameActive < g.FrameCount - 2)
+            {
+                window->Viewport = NULL;
+                window->ViewportOwned = false;
+            }
+        int write_n = 0;
+        for (ImGuiViewportP* viewport : g.Viewports)
+        {
+            if (viewport->LastFrameActive < g.FrameCount - 2)
+                DestroyViewport(viewport);
+            else
+                g.Viewports[write_n++] = viewport;
+        }
+        g.Viewports.resize(write_n);
+    }
+
     for (int n = 0; n < g.Viewports.Size; n++)
     {
         ImGuiViewportP* viewport = g.Viewports[n];
         viewport->Idx = n;
 
-        // Erase unused viewports
-        if (n > 0 && viewport->LastFrameActive < g.FrameCount - 2)
-        {
-            DestroyViewport(viewport);
-            n--;
-            continue;
-        }
-
         const bool platform_funcs_available = viewport->PlatformWindowCreated;
         if (viewports_enabled)
         {
@@ -16976,6 +17179,7 @@ ImGuiViewportP* ImGui::AddUpdateViewport(ImGuiWindow* window, ImGuiID id, const
         viewport->Flags = flags;
         UpdateViewportPlatformMonitor(viewport);
         g.Viewports.push_back(viewport);
+        g.ViewportsById.SetVoidPtr(id, viewport);
         g.ViewportCreatedCount++;
         IMGUI_DEBUG_LOG_VIEWPORT("[viewport] Add Viewport %08X '%s'\n", id, window ? window->Name : "<NULL>");
 
@@ -17006,26 +17210,20 @@ ImGuiViewportP* ImGui::AddUpdateViewport(ImGuiWindow* window, ImGuiID id, const
     return viewport;
 }
 
+// Caller is responsible for removing the viewport from g.Viewports[] and clearing references to it in windows,
+// which UpdateViewportsNewFrame() does in a single pass for all the viewports it destroys.
 static void ImGui::DestroyViewport(ImGuiViewportP* viewport)
 {
-    // Clear references to this viewport in windows (window->ViewportId becomes the master data)
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindow* window : g.Windows)
-    {
-        if (window->Viewport != viewport)
-            continue;
-        window->Viewport = NULL;
-        window->ViewportOwned = false;
-    }
     if (viewport == g.MouseLastHoveredViewport)
         g.MouseLastHoveredViewport = NULL;
+    if (g.ViewportsById.GetVoidPtr(viewport->ID) == viewport)
+        g.ViewportsById.SetVoidPtr(viewport->ID, NULL);
 
     // Destroy
     IMGUI_DEBUG_LOG_VIEWPORT("[viewport] Delete Viewport %08X '%s'\n", viewport->ID, viewport->Window ? viewport->Window->Name : "n/a");
     DestroyPlatformWindow(viewport); // In most circumstances the platform window will already be destroyed here.
     IM_ASSERT(g.PlatformIO.Viewports.contains(viewport) == false);
-    IM_ASSERT(g.Viewports[viewport->Idx] == viewport);
-    g.Viewports.erase(g.Viewports.Data + viewport->Idx);
     IM_DELETE(viewport);
 }
 
@@ -17076,7 +17274,8 @@ static void ImGui::WindowSelectViewport(ImGuiWindow* window)
         if (window->Viewport && (window->Flags & ImGuiWindowFlags_DockNodeHost) != 0 && window->Viewport->Window != NULL)
         {
             window->Viewport->Window = window;
-            window->Viewport->ID = window->ViewportId = window->ID; // Overwrite ID (always owned by node)
+            SetViewportID(window->Viewport, window->ID); // Overwrite ID (always owned by node)
+            window->ViewportId = window->ID;
         }
         lock_viewport = true;
     }
@@ -17144,7 +17343,7 @@ static void ImGui::WindowSelectViewport(ImGuiWindow* window)
                 // Steal/transfer ownership
                 IMGUI_DEBUG_LOG_VIEWPORT("[viewport] Window '%s' steal Viewport %08X from Window '%s'\n", window->Name, window->Viewport->ID, window->Viewport->Window->Name);
                 window->Viewport->Window = window;
-                window->Viewport->ID = window->ID;
+                SetViewportID(window->Viewport, window->ID);
                 window->Viewport->LastNameHash = 0;
             }
             else if (!UpdateTryMergeWindowIntoHostViewports(window)) // Merge?
@@ -18908,7 +19107,7 @@ static void ImGui::DockNodeUpdate(ImGuiDockNode* node)
                 single_window->ViewportId = node->HostWindow->ViewportId;
                 if (node->HostWindow->ViewportOwned)
                 {
-                    single_window->Viewport->ID = single_window->ID;
+                    SetViewportID(single_window->Viewport, single_window->ID);
                     single_window->Viewport->Window = single_window;
                     single_window->ViewportOwned = true;
                 }
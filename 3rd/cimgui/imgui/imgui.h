@@ -50,7 +50,7 @@ Index of this file:
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiWindowClass, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage, ImGuiSelectionExternalStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
@@ -204,6 +204,7 @@ struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDa
 struct ImGuiPlatformMonitor;        // Multi-viewport support: user-provided bounds for each connected monitor/display. Used when positioning popups and tooltips to avoid them straddling monitors
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection state of item indices as sorted ranges + apply multi-selection requests (for very large lists).
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
@@ -2896,6 +2897,9 @@ struct ImGuiTextBuffer
     IMGUI_API void      append(const char* str, const char* str_end = NULL);
     IMGUI_API void      appendf(const char* fmt, ...) IM_FMTARGS(2);
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    void                appendc(char c)         { append(&c, &c + 1); }
+    IMGUI_API void      appendi(ImS64 v);                           // Same output as appendf("%lld", v) without going through the formatter.
+    IMGUI_API void      appendd(double v, int decimals = 3);        // Same output as appendf("%.*f", decimals, v). Uses the formatter only for large/non-finite values and rounding ties.
 };
 
 // [Internal] Key+Value for ImGuiStorage
@@ -3099,7 +3103,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage)
 //-----------------------------------------------------------------------------
 
 // Multi-selection system
@@ -3234,6 +3238,31 @@ struct ImGuiSelectionBasicStorage
     inline ImGuiID  GetStorageIdFromIndex(int idx)              { return AdapterIndexToStorageId(this, idx); }  // Convert index to item id based on provided adapter.
 };
 
+// Optional helper to store multi-selection state as sorted ranges of item indices + apply multi-selection requests.
+// - Alternative to ImGuiSelectionBasicStorage for very large lists (e.g. 1M+ items): Ctrl+A or Shift+Click over the whole list
+//   stores a single range instead of one entry per item, and Contains() is a binary search over ranges.
+// - Always stores the indices passed to SetNextItemSelectionUserData(): there is no adapter, selection order is not preserved,
+//   and selection is not updated if your items are inserted/removed/reordered.
+// - Iterate selection with 'void* it = NULL; int first, last; while (selection.GetNextSelectedRange(&it, &first, &last)) { ... }' (inclusive)
+//   or one item at a time with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }'.
+struct ImGuiSelectionRangeStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<int>   _Ranges;        // [Internal] Sorted, disjoint and non-adjacent [first, last+1) pairs. Prefer not accessing directly: iterate with GetNextSelectedRange().
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    IMGUI_API void  SetItemSelected(int idx, bool selected);    // Add/remove an item from selection
+    IMGUI_API void  SetRangeSelected(int first, int last, bool selected); // Add/remove items [first..last] (inclusive) from selection (generally done by ApplyRequests() function)
+    IMGUI_API bool  GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last); // Iterate selection ranges. Both 'out_first' and 'out_last' are selected.
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, int* out_idx);                   // Iterate selected items, in increasing order.
+};
+
 // Optional helper to apply multi-selection requests to existing randomly accessible storage.
 // Convenient if you want to quickly wire multi-select API on e.g. an array of bool or items storing their own selection state.
 struct ImGuiSelectionExternalStorage
@@ -2899,6 +2899,47 @@ static void DemoWindowWidgetsSelectionAndMultiSelect(ImGuiDemoWindowData* demo_d
             ImGui::TreePop();
         }
 
+        // Demonstrate using ImGuiSelectionRangeStorage for very large lists
+        IMGUI_DEMO_MARKER("Widgets/Selection State/Multi-Select (with range storage)");
+        if (ImGui::TreeNode("Multi-Select (with range storage)"))
+        {
+            // Selection is stored as sorted ranges of indices: Ctrl+A or Shift+Click over all items stores a single range.
+            static ImGuiSelectionRangeStorage selection;
+
+            ImGui::Text("Added features:");
+            ImGui::BulletText("Using ImGuiSelectionRangeStorage.");
+
+            const int ITEMS_COUNT = 1000000;
+            ImGui::Text("Selection: %d/%d (%d ranges)", selection.Size, ITEMS_COUNT, selection._Ranges.Size / 2);
+            if (ImGui::BeginChild("##Basket", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiMultiSelectFlags flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d;
+                ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(flags, selection.Size, ITEMS_COUNT);
+                selection.ApplyRequests(ms_io);
+
+                ImGuiListClipper clipper;
+                clipper.Begin(ITEMS_COUNT);
+                if (ms_io->RangeSrcItem != -1)
+                    clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem); // Ensure RangeSrc item is not clipped.
+                while (clipper.Step())
+                {
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        char label[64];
+                        sprintf(label, "Object %07d: %s", n, ExampleNames[n % IM_COUNTOF(ExampleNames)]);
+                        bool item_is_selected = selection.Contains(n);
+                        ImGui::SetNextItemSelectionUserData(n);
+                        ImGui::Selectable(label, item_is_selected);
+                    }
+                }
+
+                ms_io = ImGui::EndMultiSelect();
+                selection.ApplyRequests(ms_io);
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
+
         // Demonstrate dynamic item list + deletion support using the BeginMultiSelect/EndMultiSelect API.
         // In order to support Deletion without any glitches you need to:
         // - (1) If items are submitted in their own scrolling area, submit contents size SetNextWindowContentSize() ahead of time to prevent one-frame readjustment of scrolling.
@@ -24,6 +24,7 @@
 
 // CHANGELOG
 //  2026-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
+//  2026-XX-XX: Vertex/index buffers grow geometrically and no longer call SDL_WaitForGPUIdle() when resized. Texture updates of a frame are packed into one transfer buffer and recorded in the copy pass of ImGui_ImplSDLGPU3_PrepareDrawData().
 //  2025-11-26: macOS version can use MSL shaders in order to support macOS 10.14+ (vs Metallib shaders requiring macOS 14+). Requires calling SDL_CreateGPUDevice() with SDL_GPU_SHADERFORMAT_MSL.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-08-20: Added ImGui_ImplSDLGPU3_InitInfo::SwapchainComposition and ImGui_ImplSDLGPU3_InitInfo::PresentMode to configure how secondary viewports are created.
@@ -50,9 +51,11 @@ struct ImGui_ImplSDLGPU3_FrameData
     SDL_GPUBuffer*          VertexBuffer            = nullptr;
     SDL_GPUTransferBuffer*  VertexTransferBuffer    = nullptr;
     uint32_t                VertexBufferSize        = 0;
+    uint32_t                VertexBufferIdleFrames  = 0;    // Successive frames using less than a quarter of VertexBufferSize
     SDL_GPUBuffer*          IndexBuffer             = nullptr;
     SDL_GPUTransferBuffer*  IndexTransferBuffer     = nullptr;
     uint32_t                IndexBufferSize         = 0;
+    uint32_t                IndexBufferIdleFrames   = 0;
 };
 
 struct ImGui_ImplSDLGPU3_Data
@@ -74,6 +77,7 @@ struct ImGui_ImplSDLGPU3_Data
 
 // Forward Declarations
 static void ImGui_ImplSDLGPU3_DestroyFrameData();
+static void ImGui_ImplSDLGPU3_UpdateTextures(ImTextureData* const* textures, int textures_count, SDL_GPUCopyPass* copy_pass);
 
 //-----------------------------------------------------------------------------
 // FUNCTIONS
@@ -128,13 +132,32 @@ static void ImGui_ImplSDLGPU3_SetupRenderState(ImDrawData* draw_data, ImGui_Impl
     SDL_PushGPUVertexUniformData(command_buffer, 0, &ubo, sizeof(UBO));
 }
 
+// Grow with 50% slack so that a UI growing a little every frame (scrolling log, opening tree nodes) only reallocates every now and then.
+// Shrink once the buffer has been less than a quarter used for a while, so sizes going back and forth don't reallocate either.
+static uint32_t ImGui_ImplSDLGPU3_CalcBufferSize(uint32_t current_size, uint32_t required_size, uint32_t* idle_frames)
+{
+    const uint32_t IDLE_FRAMES_BEFORE_SHRINK = 120;
+    if (current_size < required_size)
+    {
+        *idle_frames = 0;
+        return required_size + required_size / 2;
+    }
+    if (required_size >= current_size / 4)
+        *idle_frames = 0;
+    else if (++*idle_frames >= IDLE_FRAMES_BEFORE_SHRINK)
+    {
+        *idle_frames = 0;
+        return required_size + required_size / 2;
+    }
+    return current_size;
+}
+
 static void CreateOrResizeBuffers(SDL_GPUBuffer** buffer, SDL_GPUTransferBuffer** transferbuffer, uint32_t* old_size, uint32_t new_size, SDL_GPUBufferUsageFlags usage)
 {
     ImGui_ImplSDLGPU3_Data* bd = ImGui_ImplSDLGPU3_GetBackendData();
     ImGui_ImplSDLGPU3_InitInfo* v = &bd->InitInfo;
 
-    // FIXME-OPT: Not optimal, but this is fairly rarely called.
-    SDL_WaitForGPUIdle(v->Device);
+    // No need to wait for the GPU: SDL defers freeing the old buffers until the command buffers using them have completed.
     SDL_ReleaseGPUBuffer(v->Device, *buffer);
     SDL_ReleaseGPUTransferBuffer(v->Device, *transferbuffer);
 
@@ -164,23 +187,18 @@ void ImGui_ImplSDLGPU3_PrepareDrawData(ImDrawData* draw_data, SDL_GPUCommandBuff
     if (fb_width <= 0 || fb_height <= 0 || draw_data->TotalVtxCount <= 0)
         return;
 
-    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
-    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
-    if (draw_data->Textures != nullptr)
-        for (ImTextureData* tex : *draw_data->Textures)
-            if (tex->Status != ImTextureStatus_OK)
-                ImGui_ImplSDLGPU3_UpdateTexture(tex);
-
     ImGui_ImplSDLGPU3_Data* bd = ImGui_ImplSDLGPU3_GetBackendData();
     ImGui_ImplSDLGPU3_InitInfo* v = &bd->InitInfo;
     ImGui_ImplSDLGPU3_FrameData* fd = &bd->MainWindowFrameData;
 
     uint32_t vertex_size = draw_data->TotalVtxCount * sizeof(ImDrawVert);
     uint32_t index_size  = draw_data->TotalIdxCount * sizeof(ImDrawIdx);
-    if (fd->VertexBuffer == nullptr || fd->VertexBufferSize < vertex_size)
-        CreateOrResizeBuffers(&fd->VertexBuffer, &fd->VertexTransferBuffer, &fd->VertexBufferSize, vertex_size, SDL_GPU_BUFFERUSAGE_VERTEX);
-    if (fd->IndexBuffer == nullptr || fd->IndexBufferSize < index_size)
-        CreateOrResizeBuffers(&fd->IndexBuffer, &fd->IndexTransferBuffer, &fd->IndexBufferSize, index_size, SDL_GPU_BUFFERUSAGE_INDEX);
+    uint32_t vertex_buffer_size = ImGui_ImplSDLGPU3_CalcBufferSize(fd->VertexBufferSize, vertex_size, &fd->VertexBufferIdleFrames);
+    uint32_t index_buffer_size = ImGui_ImplSDLGPU3_CalcBufferSize(fd->IndexBufferSize, index_size, &fd->IndexBufferIdleFrames);
+    if (fd->VertexBuffer == nullptr || fd->VertexBufferSize != vertex_buffer_size)
+        CreateOrResizeBuffers(&fd->VertexBuffer, &fd->VertexTransferBuffer, &fd->VertexBufferSize, vertex_buffer_size, SDL_GPU_BUFFERUSAGE_VERTEX);
+    if (fd->IndexBuffer == nullptr || fd->IndexBufferSize != index_buffer_size)
+        CreateOrResizeBuffers(&fd->IndexBuffer, &fd->IndexTransferBuffer, &fd->IndexBufferSize, index_buffer_size, SDL_GPU_BUFFERUSAGE_INDEX);
 
     ImDrawVert* vtx_dst = (ImDrawVert*)SDL_MapGPUTransferBuffer(v->Device, fd->VertexTransferBuffer, true);
     ImDrawIdx* idx_dst = (ImDrawIdx*)SDL_MapGPUTransferBuffer(v->Device, fd->IndexTransferBuffer, true);
@@ -212,6 +230,12 @@ void ImGui_ImplSDLGPU3_PrepareDrawData(ImDrawData* draw_data, SDL_GPUCommandBuff
     index_buffer_region.size = index_size;
 
     SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        ImGui_ImplSDLGPU3_UpdateTextures(draw_data->Textures->Data, draw_data->Textures->Size, copy_pass);
+
     SDL_UploadToGPUBuffer(copy_pass, &vertex_buffer_location, &vertex_buffer_region, true);
     SDL_UploadToGPUBuffer(copy_pass, &index_buffer_location, &index_buffer_region, true);
     SDL_EndGPUCopyPass(copy_pass);
@@ -320,96 +344,131 @@ static void ImGui_ImplSDLGPU3_DestroyTexture(ImTextureData* tex)
     tex->SetStatus(ImTextureStatus_Destroyed);
 }
 
-void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
+static void ImGui_ImplSDLGPU3_CreateTexture(ImTextureData* tex)
+{
+    ImGui_ImplSDLGPU3_Data* bd = ImGui_ImplSDLGPU3_GetBackendData();
+
+    // Create and upload new texture to graphics system
+    //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+    IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+    IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+
+    // Create texture
+    SDL_GPUTextureCreateInfo texture_info = {};
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    texture_info.width = tex->Width;
+    texture_info.height = tex->Height;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    texture_info.sample_count = SDL_GPU_SAMPLECOUNT_1;
+
+    SDL_GPUTexture* raw_tex = SDL_CreateGPUTexture(bd->InitInfo.Device, &texture_info);
+    IM_ASSERT(raw_tex != nullptr && "Failed to create texture, call SDL_GetError() for more info");
+
+    // Store identifiers
+    tex->SetTexID((ImTextureID)(intptr_t)raw_tex);
+}
+
+// Update full texture or selected blocks. We only ever write to textures regions which have never been used before!
+// This backend choose to use tex->UpdateRect but you can use tex->Updates[] to upload individual regions.
+// We could use the smaller rect on _WantCreate but using the full rect allows us to clear the texture.
+static ImTextureRect ImGui_ImplSDLGPU3_GetUploadRect(ImTextureData* tex)
+{
+    if (tex->Status != ImTextureStatus_WantCreate)
+        return tex->UpdateRect;
+    ImTextureRect r = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+    return r;
+}
+
+// Process all texture requests of a frame, packing the regions to upload into one transfer buffer and recording the copies into copy_pass.
+static void ImGui_ImplSDLGPU3_UpdateTextures(ImTextureData* const* textures, int textures_count, SDL_GPUCopyPass* copy_pass)
 {
     ImGui_ImplSDLGPU3_Data* bd = ImGui_ImplSDLGPU3_GetBackendData();
     ImGui_ImplSDLGPU3_InitInfo* v = &bd->InitInfo;
 
-    if (tex->Status == ImTextureStatus_WantCreate)
+    // Create textures and measure total upload size
+    uint32_t upload_size = 0;
+    for (int tex_n = 0; tex_n < textures_count; tex_n++)
     {
-        // Create and upload new texture to graphics system
-        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
-        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        ImTextureData* tex = textures[tex_n];
+        if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+            ImGui_ImplSDLGPU3_DestroyTexture(tex);
+        if (tex->Status != ImTextureStatus_WantCreate && tex->Status != ImTextureStatus_WantUpdates)
+            continue;
+        if (tex->Status == ImTextureStatus_WantCreate)
+            ImGui_ImplSDLGPU3_CreateTexture(tex);
         IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
 
-        // Create texture
-        SDL_GPUTextureCreateInfo texture_info = {};
-        texture_info.type = SDL_GPU_TEXTURETYPE_2D;
-        texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
-        texture_info.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
-        texture_info.width = tex->Width;
-        texture_info.height = tex->Height;
-        texture_info.layer_count_or_depth = 1;
-        texture_info.num_levels = 1;
-        texture_info.sample_count = SDL_GPU_SAMPLECOUNT_1;
-
-        SDL_GPUTexture* raw_tex = SDL_CreateGPUTexture(v->Device, &texture_info);
-        IM_ASSERT(raw_tex != nullptr && "Failed to create texture, call SDL_GetError() for more info");
-
-        // Store identifiers
-        tex->SetTexID((ImTextureID)(intptr_t)raw_tex);
+        const ImTextureRect r = ImGui_ImplSDLGPU3_GetUploadRect(tex);
+        upload_size += r.w * r.h * tex->BytesPerPixel;
     }
+    if (upload_size == 0)
+        return;
 
-    if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+    // Create transfer buffer. Like vertex buffers, SDL defers freeing the old one until it is no longer in use.
+    if (bd->TexTransferBufferSize < upload_size)
     {
-        SDL_GPUTexture* raw_tex = (SDL_GPUTexture*)(intptr_t)tex->GetTexID();
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+        SDL_ReleaseGPUTransferBuffer(v->Device, bd->TexTransferBuffer);
+        SDL_GPUTransferBufferCreateInfo transferbuffer_info = {};
+        transferbuffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferbuffer_info.size = upload_size + upload_size / 2;
+        bd->TexTransferBufferSize = transferbuffer_info.size;
+        bd->TexTransferBuffer = SDL_CreateGPUTransferBuffer(v->Device, &transferbuffer_info);
+        IM_ASSERT(bd->TexTransferBuffer != nullptr && "Failed to create transfer buffer, call SDL_GetError() for more information");
+    }
 
-        // Update full texture or selected blocks. We only ever write to textures regions which have never been used before!
-        // This backend choose to use tex->UpdateRect but you can use tex->Updates[] to upload individual regions.
-        // We could use the smaller rect on _WantCreate but using the full rect allows us to clear the texture.
-        const int upload_x = (tex->Status == ImTextureStatus_WantCreate) ? 0 : tex->UpdateRect.x;
-        const int upload_y = (tex->Status == ImTextureStatus_WantCreate) ? 0 : tex->UpdateRect.y;
-        const int upload_w = (tex->Status == ImTextureStatus_WantCreate) ? tex->Width : tex->UpdateRect.w;
-        const int upload_h = (tex->Status == ImTextureStatus_WantCreate) ? tex->Height : tex->UpdateRect.h;
-        uint32_t upload_pitch = upload_w * tex->BytesPerPixel;
-        uint32_t upload_size = upload_w * upload_h * tex->BytesPerPixel;
-
-        // Create transfer buffer
-        if (bd->TexTransferBufferSize < upload_size)
-        {
-            SDL_ReleaseGPUTransferBuffer(v->Device, bd->TexTransferBuffer);
-            SDL_GPUTransferBufferCreateInfo transferbuffer_info = {};
-            transferbuffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferbuffer_info.size = upload_size + 1024;
-            bd->TexTransferBufferSize = upload_size + 1024;
-            bd->TexTransferBuffer = SDL_CreateGPUTransferBuffer(v->Device, &transferbuffer_info);
-            IM_ASSERT(bd->TexTransferBuffer != nullptr && "Failed to create transfer buffer, call SDL_GetError() for more information");
-        }
+    // Copy all regions to transfer buffer, each texture uploading from its own offset
+    uint8_t* transfer_ptr = (uint8_t*)SDL_MapGPUTransferBuffer(v->Device, bd->TexTransferBuffer, true);
+    uint32_t offset = 0;
+    for (int tex_n = 0; tex_n < textures_count; tex_n++)
+    {
+        ImTextureData* tex = textures[tex_n];
+        if (tex->Status != ImTextureStatus_WantCreate && tex->Status != ImTextureStatus_WantUpdates)
+            continue;
 
-        // Copy to transfer buffer
-        {
-            void* texture_ptr = SDL_MapGPUTransferBuffer(v->Device, bd->TexTransferBuffer, true);
-            for (int y = 0; y < upload_h; y++)
-                memcpy((void*)((uintptr_t)texture_ptr + y * upload_pitch), tex->GetPixelsAt(upload_x, upload_y + y), upload_pitch);
-            SDL_UnmapGPUTransferBuffer(v->Device, bd->TexTransferBuffer);
-        }
+        SDL_GPUTexture* raw_tex = (SDL_GPUTexture*)(intptr_t)tex->GetTexID();
+        const ImTextureRect r = ImGui_ImplSDLGPU3_GetUploadRect(tex);
+        const uint32_t upload_pitch = r.w * tex->BytesPerPixel;
+        for (int y = 0; y < r.h; y++)
+            memcpy(transfer_ptr + offset + y * upload_pitch, tex->GetPixelsAt(r.x, r.y + y), upload_pitch);
 
         SDL_GPUTextureTransferInfo transfer_info = {};
-        transfer_info.offset = 0;
+        transfer_info.offset = offset;
         transfer_info.transfer_buffer = bd->TexTransferBuffer;
 
         SDL_GPUTextureRegion texture_region = {};
         texture_region.texture = raw_tex;
-        texture_region.x = (Uint32)upload_x;
-        texture_region.y = (Uint32)upload_y;
-        texture_region.w = (Uint32)upload_w;
-        texture_region.h = (Uint32)upload_h;
+        texture_region.x = (Uint32)r.x;
+        texture_region.y = (Uint32)r.y;
+        texture_region.w = (Uint32)r.w;
+        texture_region.h = (Uint32)r.h;
         texture_region.d = 1;
 
-        // Upload
-        {
-            SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(v->Device);
-            SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(cmd);
-            SDL_UploadToGPUTexture(copy_pass, &transfer_info, &texture_region, false);
-            SDL_EndGPUCopyPass(copy_pass);
-            SDL_SubmitGPUCommandBuffer(cmd);
-        }
-
+        SDL_UploadToGPUTexture(copy_pass, &transfer_info, &texture_region, false);
+        offset += upload_pitch * r.h;
         tex->SetStatus(ImTextureStatus_OK);
     }
+    SDL_UnmapGPUTransferBuffer(v->Device, bd->TexTransferBuffer);
+}
+
+void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
+{
+    ImGui_ImplSDLGPU3_Data* bd = ImGui_ImplSDLGPU3_GetBackendData();
+    ImGui_ImplSDLGPU3_InitInfo* v = &bd->InitInfo;
+
     if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
         ImGui_ImplSDLGPU3_DestroyTexture(tex);
+    if (tex->Status != ImTextureStatus_WantCreate && tex->Status != ImTextureStatus_WantUpdates)
+        return;
+
+    // Upload
+    SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(v->Device);
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(cmd);
+    ImGui_ImplSDLGPU3_UpdateTextures(&tex, 1, copy_pass);
+    SDL_EndGPUCopyPass(copy_pass);
+    SDL_SubmitGPUCommandBuffer(cmd);
 }
 
 static void ImGui_ImplSDLGPU3_CreateShaders()
@@ -622,6 +681,7 @@ void ImGui_ImplSDLGPU3_DestroyFrameData()
     fd->VertexBuffer = fd->IndexBuffer = nullptr;
     fd->VertexTransferBuffer = fd->IndexTransferBuffer = nullptr;
     fd->VertexBufferSize = fd->IndexBufferSize = 0;
+    fd->VertexBufferIdleFrames = fd->IndexBufferIdleFrames = 0;
 }
 
 void ImGui_ImplSDLGPU3_DestroyDeviceObjects()
@@ -635,7 +695,7 @@ void ImGui_ImplSDLGPU3_DestroyDeviceObjects()
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
         if (tex->RefCount == 1)
             ImGui_ImplSDLGPU3_DestroyTexture(tex);
-    if (bd->TexTransferBuffer)  { SDL_ReleaseGPUTransferBuffer(v->Device, bd->TexTransferBuffer); bd->TexTransferBuffer = nullptr; }
+    if (bd->TexTransferBuffer)  { SDL_ReleaseGPUTransferBuffer(v->Device, bd->TexTransferBuffer); bd->TexTransferBuffer = nullptr; bd->TexTransferBufferSize = 0; }
     if (bd->VertexShader)       { SDL_ReleaseGPUShader(v->Device, bd->VertexShader); bd->VertexShader = nullptr; }
     if (bd->FragmentShader)     { SDL_ReleaseGPUShader(v->Device, bd->FragmentShader); bd->FragmentShader = nullptr; }
     if (bd->TexSamplerLinear)   { SDL_ReleaseGPUSampler(v->Device, bd->TexSamplerLinear); bd->TexSamplerLinear = nullptr; }
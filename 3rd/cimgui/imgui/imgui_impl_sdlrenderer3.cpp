@@ -26,6 +26,7 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2026-XX-XX: Convert vertex colors once per draw list (SSE2/NEON when available), only pass the vertex range referenced by each command, merge consecutive commands sharing texture and clip rectangle.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-06-11: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplSDLRenderer3_CreateFontsTexture() and ImGui_ImplSDLRenderer3_DestroyFontsTexture().
 //  2025-01-18: Use endian-dependent RGBA32 texture format, to match SDL_Color.
@@ -40,6 +41,15 @@
 #include "imgui_impl_sdlrenderer3.h"
 #include <stdint.h>     // intptr_t
 
+// SIMD unpacking of vertex colors
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && !defined(IMGUI_DISABLE_SSE) && !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#define IMGUI_IMPL_SDLRENDERER3_USE_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_IMPL_SDLRENDERER3_USE_NEON
+#include <arm_neon.h>
+#endif
+
 // Clang warnings with -Weverything
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -122,21 +132,48 @@ void ImGui_ImplSDLRenderer3_NewFrame()
 }
 
 // https://github.com/libsdl-org/SDL/issues/9009
-static int SDL_RenderGeometryRaw8BitColor(SDL_Renderer* renderer, ImVector<SDL_FColor>& colors_out, SDL_Texture* texture, const float* xy, int xy_stride, const SDL_Color* color, int color_stride, const float* uv, int uv_stride, int num_vertices, const void* indices, int num_indices, int size_indices)
+// SDL_RenderGeometryRaw() only takes float colors, so we convert a whole draw list once and have every command point into the result.
+// (ImDrawVert::col is laid out as r,g,b,a bytes in memory, same as SDL_Color)
+static void ImGui_ImplSDLRenderer3_ConvertColors(SDL_FColor* dst, const ImDrawVert* src, int count)
 {
-    const Uint8* color2 = (const Uint8*)color;
-    colors_out.resize(num_vertices);
-    SDL_FColor* color3 = colors_out.Data;
-    for (int i = 0; i < num_vertices; i++)
+    const float scale = 1.0f / 255.0f;
+    int i = 0;
+#if defined(IMGUI_IMPL_SDLRENDERER3_USE_SSE2)
+    const __m128 scale4 = _mm_set1_ps(scale);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
     {
-        color3[i].r = color->r / 255.0f;
-        color3[i].g = color->g / 255.0f;
-        color3[i].b = color->b / 255.0f;
-        color3[i].a = color->a / 255.0f;
-        color2 += color_stride;
-        color = (const SDL_Color*)color2;
+        __m128i c8 = _mm_setr_epi32((int)src[i].col, (int)src[i + 1].col, (int)src[i + 2].col, (int)src[i + 3].col);
+        __m128i c16_lo = _mm_unpacklo_epi8(c8, zero);
+        __m128i c16_hi = _mm_unpackhi_epi8(c8, zero);
+        float* out = (float*)(void*)(dst + i);
+        _mm_storeu_ps(out + 0,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(c16_lo, zero)), scale4));
+        _mm_storeu_ps(out + 4,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(c16_lo, zero)), scale4));
+        _mm_storeu_ps(out + 8,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(c16_hi, zero)), scale4));
+        _mm_storeu_ps(out + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(c16_hi, zero)), scale4));
+    }
+#elif defined(IMGUI_IMPL_SDLRENDERER3_USE_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32_t cols[4] = { src[i].col, src[i + 1].col, src[i + 2].col, src[i + 3].col };
+        uint8x16_t c8 = vreinterpretq_u8_u32(vld1q_u32(cols));
+        uint16x8_t c16_lo = vmovl_u8(vget_low_u8(c8));
+        uint16x8_t c16_hi = vmovl_u8(vget_high_u8(c8));
+        float* out = (float*)(void*)(dst + i);
+        vst1q_f32(out + 0,  vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(c16_lo))), scale));
+        vst1q_f32(out + 4,  vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(c16_lo))), scale));
+        vst1q_f32(out + 8,  vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(c16_hi))), scale));
+        vst1q_f32(out + 12, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(c16_hi))), scale));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const SDL_Color* color = (const SDL_Color*)(const void*)&src[i].col;
+        dst[i].r = color->r * scale;
+        dst[i].g = color->g * scale;
+        dst[i].b = color->b * scale;
+        dst[i].a = color->a * scale;
     }
-    return SDL_RenderGeometryRaw(renderer, texture, xy, xy_stride, color3, sizeof(*color3), uv, uv_stride, num_vertices, indices, num_indices, size_indices);
 }
 
 void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer* renderer)
@@ -199,6 +236,11 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data;
 
+        // Convert colors once for the whole list
+        bd->ColorBuffer.resize(draw_list->VtxBuffer.Size);
+        ImGui_ImplSDLRenderer3_ConvertColors(bd->ColorBuffer.Data, vtx_buffer, draw_list->VtxBuffer.Size);
+        const SDL_FColor* col_buffer = bd->ColorBuffer.Data;
+
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
@@ -226,18 +268,37 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
                 SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
                 SDL_SetRenderClipRect(renderer, &r);
 
+                // Merge following commands drawing with the same texture and clip rectangle from contiguous indices
+                unsigned int elem_count = pcmd->ElemCount;
+                while (cmd_i + 1 < draw_list->CmdBuffer.Size)
+                {
+                    const ImDrawCmd* next_cmd = &draw_list->CmdBuffer[cmd_i + 1];
+                    if (next_cmd->UserCallback != nullptr || next_cmd->VtxOffset != pcmd->VtxOffset || next_cmd->IdxOffset != pcmd->IdxOffset + elem_count ||
+                        next_cmd->GetTexID() != pcmd->GetTexID() || memcmp(&next_cmd->ClipRect, &pcmd->ClipRect, sizeof(pcmd->ClipRect)) != 0)
+                        break;
+                    elem_count += next_cmd->ElemCount;
+                    cmd_i++;
+                }
+
+                // Only hand over the vertices actually referenced by the indices, SDL validates every one of them
+                const ImDrawIdx* indices = idx_buffer + pcmd->IdxOffset;
+                unsigned int max_idx = 0;
+                for (unsigned int n = 0; n < elem_count; n++)
+                    max_idx = (indices[n] > max_idx) ? indices[n] : max_idx;
+                const int num_vertices = (elem_count > 0) ? (int)max_idx + 1 : 0;
+
                 const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
                 const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
-                const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
+                const SDL_FColor* color = col_buffer + pcmd->VtxOffset;
 
                 // Bind texture, Draw
                 SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
-                SDL_RenderGeometryRaw8BitColor(renderer, bd->ColorBuffer, tex,
+                SDL_RenderGeometryRaw(renderer, tex,
                     xy, (int)sizeof(ImDrawVert),
-                    color, (int)sizeof(ImDrawVert),
+                    color, (int)sizeof(SDL_FColor),
                     uv, (int)sizeof(ImDrawVert),
-                    draw_list->VtxBuffer.Size - pcmd->VtxOffset,
-                    idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                    num_vertices,
+                    indices, (int)elem_count, sizeof(ImDrawIdx));
             }
         }
     }
@@ -28,6 +28,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-XX-XX: Vulkan: Vertex and index data share one persistently mapped buffer per in-flight frame, grown geometrically and shrunk with hysteresis. Flush only non-coherent memory. Skip redundant vkCmdSetScissor() calls.
 //  2026-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2025-09-26: [Helpers] *BREAKING CHANGE*: Vulkan: Helper ImGui_ImplVulkanH_DestroyWindow() does not call vkDestroySurfaceKHR(): as surface is created by caller of ImGui_ImplVulkanH_CreateOrResizeWindow(), it is more consistent that we don't destroy it. (#9163)
 //  2026-01-05: [Helpers] *BREAKING CHANGE*: Vulkan: Helper for creating render pass uses ImGui_ImplVulkanH_Window::AttachmentDesc to create render pass. Removed ClearEnabled. (#9152)
@@ -113,6 +114,9 @@
 #ifndef IM_MAX
 #define IM_MAX(A, B)    (((A) >= (B)) ? (A) : (B))
 #endif
+#ifndef IM_MIN
+#define IM_MIN(A, B)    (((A) < (B)) ? (A) : (B))
+#endif
 #undef Status // X11 headers are leaking this.
 
 // Visual Studio warnings
@@ -242,14 +246,16 @@ static PFN_vkCmdEndRenderingKHR     ImGuiImplVulkanFuncs_vkCmdEndRenderingKHR;
 
 // Reusable buffers used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
 // [Please zero-clear before use!]
+// Vertices are stored at the start of Buffer, indices follow at an aligned offset.
 struct ImGui_ImplVulkan_FrameRenderBuffers
 {
-    VkDeviceMemory      VertexBufferMemory;
-    VkDeviceMemory      IndexBufferMemory;
-    VkDeviceSize        VertexBufferSize;
-    VkDeviceSize        IndexBufferSize;
-    VkBuffer            VertexBuffer;
-    VkBuffer            IndexBuffer;
+    VkDeviceMemory      BufferMemory;
+    VkDeviceSize        BufferSize;
+    VkBuffer            Buffer;
+    VkDeviceSize        IndexOffset;            // Offset of index data in Buffer for the current frame
+    void*               MappedData;             // Persistently mapped for the lifetime of BufferMemory
+    bool                MemoryCoherent;         // When false, written ranges need vkFlushMappedMemoryRanges()
+    int                 UnderusedFrames;        // Consecutive frames where less than a quarter of BufferSize was used
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -470,38 +476,50 @@ static inline VkDeviceSize AlignBufferSize(VkDeviceSize size, VkDeviceSize align
     return (size + alignment - 1) & ~(alignment - 1);
 }
 
-static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& buffer_size, VkDeviceSize new_size, VkBufferUsageFlagBits usage)
+// Buffers grow by 50% over the requested size, and shrink back only after being mostly unused for a while (to avoid reallocating every few frames when content size oscillates).
+#define IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES  120
+
+static void CreateOrResizeFrameRenderBuffers(ImGui_ImplVulkan_FrameRenderBuffers* rb, VkDeviceSize new_size)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     VkResult err;
-    if (buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(v->Device, buffer, v->Allocator);
-    if (buffer_memory != VK_NULL_HANDLE)
-        vkFreeMemory(v->Device, buffer_memory, v->Allocator);
-
-    VkDeviceSize buffer_size_aligned = AlignBufferSize(IM_MAX(v->MinAllocationSize, new_size), bd->BufferMemoryAlignment);
+    if (rb->BufferMemory != VK_NULL_HANDLE && rb->MappedData != nullptr)
+        vkUnmapMemory(v->Device, rb->BufferMemory);
+    if (rb->Buffer != VK_NULL_HANDLE)
+        vkDestroyBuffer(v->Device, rb->Buffer, v->Allocator);
+    if (rb->BufferMemory != VK_NULL_HANDLE)
+        vkFreeMemory(v->Device, rb->BufferMemory, v->Allocator);
+
+    VkDeviceSize buffer_size_aligned = AlignBufferSize(IM_MAX(v->MinAllocationSize, new_size), IM_MAX(bd->BufferMemoryAlignment, bd->NonCoherentAtomSize));
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buffer_info.size = buffer_size_aligned;
-    buffer_info.usage = usage;
+    buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
     buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buffer);
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &rb->Buffer);
     check_vk_result(err);
 
+    // Prefer coherent memory so we never have to flush, but accept any host visible type.
     VkMemoryRequirements req;
-    vkGetBufferMemoryRequirements(v->Device, buffer, &req);
+    vkGetBufferMemoryRequirements(v->Device, rb->Buffer, &req);
     bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
     VkMemoryAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buffer_memory);
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    rb->MemoryCoherent = (alloc_info.memoryTypeIndex != 0xFFFFFFFF);
+    if (!rb->MemoryCoherent)
+        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &rb->BufferMemory);
     check_vk_result(err);
 
-    err = vkBindBufferMemory(v->Device, buffer, buffer_memory, 0);
+    err = vkBindBufferMemory(v->Device, rb->Buffer, rb->BufferMemory, 0);
+    check_vk_result(err);
+    err = vkMapMemory(v->Device, rb->BufferMemory, 0, VK_WHOLE_SIZE, 0, &rb->MappedData);
     check_vk_result(err);
-    buffer_size = buffer_size_aligned;
+    rb->BufferSize = buffer_size_aligned;
+    rb->UnderusedFrames = 0;
 }
 
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
@@ -516,10 +534,10 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     // Bind Vertex And Index Buffer:
     if (draw_data->TotalVtxCount > 0)
     {
-        VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
+        VkBuffer vertex_buffers[1] = { rb->Buffer };
         VkDeviceSize vertex_offset[1] = { 0 };
         vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
-        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(command_buffer, rb->Buffer, rb->IndexOffset, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
     }
 
     // Setup viewport:
@@ -586,21 +604,27 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     if (draw_data->TotalVtxCount > 0)
     {
-        // Create or resize the vertex/index buffers
+        // Create or resize the vertex/index buffer
         VkDeviceSize vertex_size = AlignBufferSize(draw_data->TotalVtxCount * sizeof(ImDrawVert), bd->BufferMemoryAlignment);
         VkDeviceSize index_size = AlignBufferSize(draw_data->TotalIdxCount * sizeof(ImDrawIdx), bd->BufferMemoryAlignment);
-        if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
-            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-        if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
-            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
-        VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, vertex_size, 0, (void**)&vtx_dst);
-        check_vk_result(err);
-        err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, index_size, 0, (void**)&idx_dst);
-        check_vk_result(err);
+        VkDeviceSize required_size = vertex_size + index_size;
+        if (rb->Buffer == VK_NULL_HANDLE || rb->BufferSize < required_size)
+            CreateOrResizeFrameRenderBuffers(rb, required_size + required_size / 2);
+        else if (required_size < rb->BufferSize / 4 && rb->BufferSize > v->MinAllocationSize)
+        {
+            if (++rb->UnderusedFrames >= IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES)
+                CreateOrResizeFrameRenderBuffers(rb, required_size + required_size / 2);
+        }
+        else
+        {
+            rb->UnderusedFrames = 0;
+        }
+        vertex_size = AlignBufferSize(draw_data->TotalVtxCount * sizeof(ImDrawVert), bd->BufferMemoryAlignment); // Alignment may have been raised by the allocation
+        rb->IndexOffset = vertex_size;
+
+        // Upload vertex/index data into the single mapped GPU buffer
+        ImDrawVert* vtx_dst = (ImDrawVert*)rb->MappedData;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)(void*)((char*)rb->MappedData + rb->IndexOffset);
         for (const ImDrawList* draw_list : draw_data->CmdLists)
         {
             memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
@@ -608,17 +632,16 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
             vtx_dst += draw_list->VtxBuffer.Size;
             idx_dst += draw_list->IdxBuffer.Size;
         }
-        VkMappedMemoryRange range[2] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = rb->VertexBufferMemory;
-        range[0].size = VK_WHOLE_SIZE;
-        range[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[1].memory = rb->IndexBufferMemory;
-        range[1].size = VK_WHOLE_SIZE;
-        err = vkFlushMappedMemoryRanges(v->Device, 2, range);
-        check_vk_result(err);
-        vkUnmapMemory(v->Device, rb->VertexBufferMemory);
-        vkUnmapMemory(v->Device, rb->IndexBufferMemory);
+        if (!rb->MemoryCoherent)
+        {
+            VkDeviceSize used_size = (VkDeviceSize)((char*)idx_dst - (char*)rb->MappedData);
+            VkMappedMemoryRange range = {};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = rb->BufferMemory;
+            range.size = IM_MIN(AlignBufferSize(used_size, bd->NonCoherentAtomSize), rb->BufferSize);
+            VkResult err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+            check_vk_result(err);
+        }
     }
 
     // Setup desired Vulkan state
@@ -639,6 +662,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
+    VkRect2D last_scissor = {};
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
     for (const ImDrawList* draw_list : draw_data->CmdLists)
@@ -655,6 +679,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 else
                     pcmd->UserCallback(draw_list, pcmd);
                 last_desc_set = VK_NULL_HANDLE;
+                last_scissor.extent.width = 0;
             }
             else
             {
@@ -676,7 +701,9 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 scissor.offset.y = (int32_t)(clip_min.y);
                 scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
                 scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
-                vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                if (memcmp(&scissor, &last_scissor, sizeof(scissor)) != 0)
+                    vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                last_scissor = scissor;
 
                 // Bind DescriptorSet with font or user texture
                 VkDescriptorSet desc_set = (VkDescriptorSet)pcmd->GetTexID();
@@ -1450,12 +1477,12 @@ void ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set)
 
 void ImGui_ImplVulkan_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkan_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
 {
-    if (buffers->VertexBuffer) { vkDestroyBuffer(device, buffers->VertexBuffer, allocator); buffers->VertexBuffer = VK_NULL_HANDLE; }
-    if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
-    if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
-    if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
-    buffers->VertexBufferSize = 0;
-    buffers->IndexBufferSize = 0;
+    if (buffers->BufferMemory && buffers->MappedData) { vkUnmapMemory(device, buffers->BufferMemory); buffers->MappedData = nullptr; }
+    if (buffers->Buffer) { vkDestroyBuffer(device, buffers->Buffer, allocator); buffers->Buffer = VK_NULL_HANDLE; }
+    if (buffers->BufferMemory) { vkFreeMemory(device, buffers->BufferMemory, allocator); buffers->BufferMemory = VK_NULL_HANDLE; }
+    buffers->BufferSize = 0;
+    buffers->IndexOffset = 0;
+    buffers->UnderusedFrames = 0;
 }
 
 void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkan_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
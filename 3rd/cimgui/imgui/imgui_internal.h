@@ -72,6 +72,11 @@ Index of this file:
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// ARMv8 CRC32 instructions compute the same CRC32c as SSE 4.2 (enabled by default on e.g. Apple Silicon, or with -march=armv8-a+crc)
+#if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_ENABLE_SSE4_2_CRC)
+#define IMGUI_ENABLE_ARM_CRC
+#include <arm_acle.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -1263,10 +1268,21 @@ struct IMGUI_API ImGuiInputTextState
     int                     ReloadSelectionStart;
     int                     ReloadSelectionEnd;
 
+    // Line index of TextA (multi-line only), kept across frames, patched around edits and extended lazily as the view needs more lines.
+    ImGuiTextIndex          LineIndex;              // start offset of every visual line (word-wrapped lines when LineIndexWrapWidth > 0.0f)
+    int                     LineIndexBuiltEnd;      // LineIndex covers all lines starting before this offset. Always the start of a hard line, TextLen + 1 once complete.
+    int                     LineIndexEditStart;     // range of TextA modified since LineIndex was last patched (in current offsets), -1 if none
+    int                     LineIndexEditEnd;
+    int                     LineIndexEditDelta;     // accumulated length change of those edits
+    ImFont*                 LineIndexFont;          // font, size and wrap width the line index was built with
+    float                   LineIndexFontSize;
+    float                   LineIndexWrapWidth;
+
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); ClearLineIndex(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineIndex.clear(); ClearLineIndex(); }
+    void        ClearLineIndex()            { LineIndex.Offsets.resize(0); LineIndexBuiltEnd = 0; LineIndexEditStart = -1; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
     float       GetPreferredOffsetX() const;
@@ -2418,6 +2434,7 @@ struct ImGuiContext
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
+    int                     WindowsFocusOrderDirtyFrom;         // ->FocusOrder of windows at this index or later in WindowsFocusOrder[] may be stale. Refreshed lazily by FindWindowFocusIndex().
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
@@ -2508,6 +2525,7 @@ struct ImGuiContext
 
     // Viewports
     ImVector<ImGuiViewportP*> Viewports;                        // Active viewports (always 1+, and generally 1 unless multi-viewports are enabled). Each viewports hold their copy of ImDrawData.
+    ImGuiStorage            ViewportsById;                      // Map viewport's ImGuiID to ImGuiViewportP*
     ImGuiViewportP*         CurrentViewport;                    // We track changes of viewport (happening in Begin) so we can call Platform_OnChangedViewport()
     ImGuiViewportP*         MouseViewport;
     ImGuiViewportP*         MouseLastHoveredViewport;           // Last known viewport that was hovered by mouse (even if we are not hovering any viewport any more) + honoring the _NoInputs flag.
@@ -2909,7 +2927,7 @@ struct IMGUI_API ImGuiWindow
     short                   BeginCountPreviousFrame;            // Number of Begin() during the previous frame
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
-    short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused. Only valid if < g.WindowsFocusOrderDirtyFrom, use FindWindowFocusIndex().
     ImGuiDir                AutoPosLastDirection;
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
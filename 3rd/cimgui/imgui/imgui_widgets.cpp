@@ -3981,6 +3981,22 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
     return ImFontCalcTextSizeEx(g.Font, g.FontSize, FLT_MAX, obj->WrapWidth, text_begin, text_end_display, text_end, out_remaining, out_offset, flags);
 }
 
+// Record a modification of TextA so the persistent line index only gets rebuilt around it (see InputTextLineIndexUpdate()).
+// Successive edits are merged into a single range expressed in current offsets + the total length change.
+static void InputTextLineIndexOnEdit(ImGuiInputTextState* state, int pos, int delete_len, int insert_len)
+{
+    if (state->LineIndexEditStart < 0)
+    {
+        state->LineIndexEditStart = pos;
+        state->LineIndexEditEnd = pos + insert_len;
+        state->LineIndexEditDelta = insert_len - delete_len;
+        return;
+    }
+    state->LineIndexEditStart = ImMin(state->LineIndexEditStart, pos);
+    state->LineIndexEditEnd = (state->LineIndexEditEnd >= pos + delete_len) ? state->LineIndexEditEnd + insert_len - delete_len : pos + insert_len;
+    state->LineIndexEditDelta += insert_len - delete_len;
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 // With our UTF-8 use of stb_textedit:
 // - STB_TEXTEDIT_GETCHAR is nothing more than a a "GETBYTE". It's only used to compare to ascii or to copy blocks of text so we are fine.
@@ -4176,6 +4192,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     memmove(dst, src, obj->TextLen - n - pos + 1);
     obj->Edited = true;
     obj->TextLen -= n;
+    InputTextLineIndexOnEdit(obj, pos, n, 0);
 }
 
 static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4207,6 +4224,7 @@ static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const cha
     obj->Edited = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
+    InputTextLineIndexOnEdit(obj, pos, 0, new_text_len);
 
     return new_text_len;
 }
@@ -4534,6 +4552,7 @@ static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char*
 
     const int insert_len = new_last_diff - first_diff + 1;
     const int delete_len = old_last_diff - first_diff + 1;
+    InputTextLineIndexOnEdit(state, first_diff, delete_len, insert_len);
     if (insert_len > 0 || delete_len > 0)
         if (IMSTB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->Stb->undostate, first_diff, delete_len, insert_len))
             for (int i = 0; i < delete_len; i++)
@@ -4637,6 +4656,89 @@ static int InputTextLineIndexBuild(ImGuiInputTextFlags flags, ImGuiTextIndex* li
     return size;
 }
 
+// Append the visual lines of the hard line starting at 'line_start'. Returns the start of the next hard line, or text_end + 1 after the last one.
+static int InputTextLineIndexAppendHardLine(ImGuiContext& g, ImVector<int>* offsets, const char* text, const char* text_end, int line_start, float wrap_width)
+{
+    const char* s = text + line_start;
+    const char* s_eol = (const char*)ImMemchr(s, '\n', (size_t)(text_end - s));
+    offsets->push_back(line_start);
+    if (wrap_width > 0.0f)
+    {
+        const char* line_end = s_eol ? s_eol : text_end;
+        while ((s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, text_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks)) < line_end)
+            offsets->push_back((int)(s - text));
+    }
+    return (int)((s_eol ? s_eol : text_end) - text) + 1;
+}
+
+// Bring the persistent line index of the active text (state->LineIndex) up to date, for the same output as InputTextLineIndexBuild().
+// - Edits recorded by InputTextLineIndexOnEdit() only rebuild the hard lines they touched, following lines are shifted.
+// - The index is then extended until it holds 'min_line_count' lines and covers 'min_offset'. Without word-wrap we always complete it
+//   (a memchr() scan per line is cheap and gives an exact line count). With word-wrap the count of lines not built yet is estimated.
+static int InputTextLineIndexUpdate(ImGuiContext& g, ImGuiInputTextState* state, float wrap_width, int min_line_count, int min_offset)
+{
+    ImVector<int>& offsets = state->LineIndex.Offsets;
+    const char* text = state->TextA.Data;
+    const char* text_end = text + state->TextLen;
+    if (state->LineIndexFont != g.Font || state->LineIndexFontSize != g.FontSize || state->LineIndexWrapWidth != wrap_width)
+    {
+        state->ClearLineIndex();
+        state->LineIndexFont = g.Font;
+        state->LineIndexFontSize = g.FontSize;
+        state->LineIndexWrapWidth = wrap_width;
+    }
+
+    // Patch lines touched by edits. Text before LineIndexEditStart is unchanged and text after LineIndexEditEnd is offset by LineIndexEditDelta.
+    if (state->LineIndexEditStart >= 0)
+    {
+        const int edit_start = state->LineIndexEditStart;
+        const int edit_end = ImMin(state->LineIndexEditEnd, state->TextLen);
+        const int delta = state->LineIndexEditDelta;
+        state->LineIndexEditStart = -1;
+        if (edit_start < state->LineIndexBuiltEnd)
+        {
+            const int rebuild_start = (int)(ImStrbol(text + edit_start, text) - text);
+            const char* next_eol = (const char*)ImMemchr(text + edit_end, '\n', (size_t)(state->TextLen - edit_end));
+            const int rebuild_end = next_eol ? (int)(next_eol - text) + 1 : state->TextLen + 1;
+            const int n_start = offsets.index_from_ptr(ImLowerBound(offsets.begin(), offsets.end(), rebuild_start));
+            if (rebuild_end - delta >= state->LineIndexBuiltEnd)
+            {
+                // Edited up to the unbuilt part: drop the tail, it will be rebuilt below.
+                offsets.resize(n_start);
+                state->LineIndexBuiltEnd = rebuild_start;
+            }
+            else
+            {
+                const int n_end = offsets.index_from_ptr(ImLowerBound(offsets.begin() + n_start, offsets.end(), rebuild_end - delta));
+                ImVector<int>& rebuilt = g.InputTextLineIndex.Offsets; // Temporary storage
+                rebuilt.resize(0);
+                for (int line_start = rebuild_start; line_start < rebuild_end; )
+                    line_start = InputTextLineIndexAppendHardLine(g, &rebuilt, text, text_end, line_start, wrap_width);
+                const int tail_count = offsets.Size - n_end;
+                const int new_size = n_start + rebuilt.Size + tail_count;
+                if (new_size > offsets.Size)
+                    offsets.resize(new_size);
+                memmove(offsets.Data + n_start + rebuilt.Size, offsets.Data + n_end, (size_t)tail_count * sizeof(int));
+                memcpy(offsets.Data + n_start, rebuilt.Data, (size_t)rebuilt.Size * sizeof(int));
+                offsets.resize(new_size);
+                for (int* p = offsets.Data + n_start + rebuilt.Size; p < offsets.Data + new_size; p++)
+                    *p += delta;
+                state->LineIndexBuiltEnd += delta;
+                rebuilt.resize(0);
+            }
+        }
+    }
+    IM_ASSERT(state->LineIndexBuiltEnd <= state->TextLen + 1);
+
+    // Extend
+    while (state->LineIndexBuiltEnd <= state->TextLen && (wrap_width <= 0.0f || offsets.Size < min_line_count || state->LineIndexBuiltEnd <= min_offset))
+        state->LineIndexBuiltEnd = InputTextLineIndexAppendHardLine(g, &offsets, text, text_end, state->LineIndexBuiltEnd, wrap_width);
+    state->LineIndex.EndOffset = state->TextLen;
+    if (state->LineIndexBuiltEnd > state->TextLen)
+        return offsets.Size;
+    return offsets.Size + ImMax(1, (int)((double)(state->TextLen - state->LineIndexBuiltEnd) * offsets.Size / state->LineIndexBuiltEnd));
+}
+
 static ImVec2 InputTextLineIndexGetPosOffset(ImGuiContext& g, ImGuiInputTextState* state, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, int cursor_n)
 {
     const char* cursor_ptr = buf + cursor_n;
@@ -4835,7 +4937,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Recycle existing cursor/selection/undo stack but clamp position
         // Note a single mouse click will override the cursor/position immediately by calling stb_textedit_click handler.
         if (!recycle_state)
+        {
             stb_textedit_initialize_state(state->Stb, !is_multiline);
+            state->ClearLineIndex();
+        }
 
         if (!is_multiline)
         {
@@ -5450,10 +5555,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         CalcClipRectVisibleItemsY(clip_rect, draw_pos, g.FontSize, &line_visible_n0, &line_visible_n1);
 
     // Build line index for easy data access (makes code below simpler and faster)
+    // While editing we reuse the index kept in our state, which only needs to cover visible lines and the cursor.
     ImGuiTextIndex* line_index = &g.InputTextLineIndex;
     line_index->Offsets.resize(0);
     int line_count = 1;
-    if (is_multiline)
+    const bool use_state_line_index = is_multiline && buf_display_from_state && !is_displaying_hint;
+    if (use_state_line_index)
+    {
+        line_index = &state->LineIndex;
+        line_count = InputTextLineIndexUpdate(g, state, wrap_width, line_visible_n1 + 1, render_cursor ? state->Stb->cursor : 0);
+    }
+    else if (is_multiline)
     {
         // If scrolling is expected to change build full index.
         // FIXME-OPT: Could append to index when new value of line_visible_n1 becomes bigger, see second call to CalcClipRectVisibleItemsY() below.
@@ -5529,6 +5641,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             draw_pos.y += (draw_window->Scroll.y - scroll_y);   // Manipulate cursor pos immediately avoid a frame of lag
             draw_window->Scroll.y = scroll_y;
             CalcClipRectVisibleItemsY(clip_rect, draw_pos, g.FontSize, &line_visible_n0, &line_visible_n1);
+            if (use_state_line_index)
+            {
+                line_count = InputTextLineIndexUpdate(g, state, wrap_width, line_visible_n1 + 1, render_cursor ? state->Stb->cursor : 0);
+                text_size_y = line_count * g.FontSize;
+            }
             line_visible_n1 = ImMin(line_visible_n1, line_count);
         }
 
@@ -5667,6 +5784,7 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
         (state->Flags & ImGuiInputTextFlags_WordWrap) ? (state->LastMoveDirectionLR == ImGuiDir_Left ? " (L)" : " (R)") : "",
         stb_state->select_start, stb_state->select_end);
     Text("BufCapacity: %d, LineCount: %d", state->BufCapacity, state->LineCount);
+    Text("LineIndex: %d lines, built up to %d%s", state->LineIndex.Offsets.Size, ImMin(state->LineIndexBuiltEnd, state->TextLen), (state->LineIndexBuiltEnd > state->TextLen) ? " (complete)" : "");
     Text("(Internal Buffer: TextA Size: %d, Capacity: %d)", state->TextA.Size, state->TextA.Capacity);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
     Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
@@ -8430,6 +8548,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 // [SECTION] Widgets: Multi-Select helpers
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
+// - ImGuiSelectionRangeStorage
 // - ImGuiSelectionExternalStorage
 //-------------------------------------------------------------------------
 
@@ -8595,6 +8714,149 @@ void ImGuiSelectionBasicStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
 
 //-------------------------------------------------------------------------
 
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _Ranges.resize(0);
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    _Ranges.swap(r._Ranges);
+}
+
+// Return the first range ending after 'idx' (== ranges count if none)
+static int ImGuiSelectionRangeStorage_FindRange(const ImVector<int>& ranges, int idx)
+{
+    int lo = 0, hi = ranges.Size / 2;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (ranges.Data[mid * 2 + 1] <= idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    const int n = ImGuiSelectionRangeStorage_FindRange(_Ranges, idx);
+    return n < _Ranges.Size / 2 && _Ranges.Data[n * 2] <= idx;
+}
+
+void ImGuiSelectionRangeStorage::SetItemSelected(int idx, bool selected)
+{
+    SetRangeSelected(idx, idx, selected);
+}
+
+// Replace all ranges overlapping [first..last] with at most two ranges.
+// When selecting, ranges touching it are merged as well so that ranges never become adjacent.
+void ImGuiSelectionRangeStorage::SetRangeSelected(int first, int last, bool selected)
+{
+    IM_ASSERT(first <= last);
+    const int end = last + 1;
+    const int n_begin = ImGuiSelectionRangeStorage_FindRange(_Ranges, selected ? first - 1 : first);
+    int n_end = n_begin;
+    int removed_count = 0;
+    for (; n_end < _Ranges.Size / 2 && (selected ? _Ranges.Data[n_end * 2] <= end : _Ranges.Data[n_end * 2] < end); n_end++)
+        removed_count += _Ranges.Data[n_end * 2 + 1] - _Ranges.Data[n_end * 2];
+
+    int new_ranges[4];
+    int new_ranges_count = 0;
+    if (selected)
+    {
+        new_ranges[0] = (n_begin < n_end) ? ImMin(first, _Ranges.Data[n_begin * 2]) : first;
+        new_ranges[1] = (n_begin < n_end) ? ImMax(end, _Ranges.Data[n_end * 2 - 1]) : end;
+        new_ranges_count = 1;
+    }
+    else if (n_begin < n_end)
+    {
+        if (_Ranges.Data[n_begin * 2] < first)
+        {
+            new_ranges[new_ranges_count * 2 + 0] = _Ranges.Data[n_begin * 2];
+            new_ranges[new_ranges_count * 2 + 1] = first;
+            new_ranges_count++;
+        }
+        if (_Ranges.Data[n_end * 2 - 1] > end)
+        {
+            new_ranges[new_ranges_count * 2 + 0] = end;
+            new_ranges[new_ranges_count * 2 + 1] = _Ranges.Data[n_end * 2 - 1];
+            new_ranges_count++;
+        }
+    }
+    else
+    {
+        return; // Nothing to unselect
+    }
+    for (int n = 0; n < new_ranges_count; n++)
+        Size += new_ranges[n * 2 + 1] - new_ranges[n * 2];
+    Size -= removed_count;
+
+    // Splice
+    const int tail_size = _Ranges.Size - n_end * 2;
+    const int size_diff = (new_ranges_count - (n_end - n_begin)) * 2;
+    if (size_diff > 0)
+        _Ranges.resize(_Ranges.Size + size_diff);
+    memmove(_Ranges.Data + (n_begin + new_ranges_count) * 2, _Ranges.Data + n_end * 2, (size_t)tail_size * sizeof(int));
+    memcpy(_Ranges.Data + n_begin * 2, new_ranges, (size_t)new_ranges_count * 2 * sizeof(int));
+    if (size_diff < 0)
+        _Ranges.resize(_Ranges.Size + size_diff);
+}
+
+bool ImGuiSelectionRangeStorage::GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last)
+{
+    const int n = (int)(intptr_t)*opaque_it;
+    if (n >= _Ranges.Size / 2)
+        return false;
+    *out_first = _Ranges.Data[n * 2];
+    *out_last = _Ranges.Data[n * 2 + 1] - 1;
+    *opaque_it = (void*)(intptr_t)(n + 1);
+    return true;
+}
+
+// Iterator stores next index to consider
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, int* out_idx)
+{
+    int idx = (int)(intptr_t)*opaque_it;
+    const int n = ImGuiSelectionRangeStorage_FindRange(_Ranges, idx);
+    if (n >= _Ranges.Size / 2)
+        return false;
+    idx = ImMax(idx, _Ranges.Data[n * 2]);
+    *out_idx = idx;
+    *opaque_it = (void*)(intptr_t)(idx + 1);
+    return true;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// SetAll/SetRange requests are each applied in O(number of ranges) regardless of how many items they cover.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
 ImGuiSelectionExternalStorage::ImGuiSelectionExternalStorage()
 {
     UserData = NULL;
@@ -123,6 +123,11 @@
     //  - SUPPORT_FILEFORMAT_JPG
     #define SUPPORT_CLIPBOARD_IMAGE         1
 #endif
+#ifndef SUPPORT_FILE_WATCHER
+    // Support files watching for assets hot-reloading: WatchFile(), LoadChangedFiles()
+    // NOTE: Using inotify on Linux, files modification time polling on other platforms
+    #define SUPPORT_FILE_WATCHER            1
+#endif
 
 // rcore: Configuration values
 // NOTE: Below values are alread defined inside [rcore.c] so there is no need to be
@@ -132,6 +137,8 @@
 //#define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
 //#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 //#define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
+//#define FILE_WATCHER_COALESCE_TIME   0.05       // Time (seconds) a watched file must stay unmodified to be reported as changed
+//#define FILE_WATCHER_POLL_COUNT       256       // Maximum number of watched files checked per frame, when polling
 //#define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
 //#define MAX_MOUSE_BUTTONS               8       // Maximum number of mouse buttons supported
 //#define MAX_GAMEPADS                    4       // Maximum number of gamepads supported
@@ -141,7 +148,7 @@
 //#define MAX_TOUCH_POINTS               10       // Maximum number of touch points supported
 //#define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 //#define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
-//#define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+//#define MAX_DECOMPRESSION_SIZE         64       // Max size DecompressData() buffer can grow up to in MB
 //#define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 //------------------------------------------------------------------------------------
 
@@ -43,7 +43,9 @@
  * `cgltf_result cgltf_load_buffer_base64(const cgltf_options* options,
  * cgltf_size size, const char* base64, void** out_data)` decodes
  * base64-encoded data content. Used internally by `cgltf_load_buffers()`.
- * This is useful when decoding data URIs in images.
+ * This is useful when decoding data URIs in images. Define
+ * `CGLTF_DECODE_BASE64(data, size, base64)` to provide an external decoder,
+ * returning nonzero when exactly `size` bytes were decoded into `data`.
  *
  * `cgltf_result cgltf_parse_file(const cgltf_options* options, const
  * char* path, cgltf_data** out_data)` can be used to open the given
@@ -1300,6 +1302,13 @@ cgltf_result cgltf_load_buffer_base64(const cgltf_options* options, cgltf_size s
 		return cgltf_result_out_of_memory;
 	}
 
+#ifdef CGLTF_DECODE_BASE64
+	if (!CGLTF_DECODE_BASE64(data, size, base64))
+	{
+		memory_free(options->memory.user_data, data);
+		return cgltf_result_io_error;
+	}
+#else
 	unsigned int buffer = 0;
 	unsigned int buffer_bits = 0;
 
@@ -1330,6 +1339,7 @@ cgltf_result cgltf_load_buffer_base64(const cgltf_options* options, cgltf_size s
 		data[i] = (unsigned char)(buffer >> (buffer_bits - 8));
 		buffer_bits -= 8;
 	}
+#endif
 
 	*out_data = data;
 
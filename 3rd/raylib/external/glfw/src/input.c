@@ -65,21 +65,113 @@ static GLFWbool initJoysticks(void)
     return _glfw.joysticksInitialized = GLFW_TRUE;
 }
 
-// Finds a mapping based on joystick GUID
+// Returns the FNV-1a hash of a mapping GUID
 //
-static _GLFWmapping* findMapping(const char* guid)
+static uint32_t hashMappingGUID(const char* guid)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*guid)
+        hash = (hash ^ (unsigned char) *guid++) * 16777619u;
+
+    return hash;
+}
+
+// Rebuilds the GUID hash index of the mapping array with the specified size
+// Slots are open addressed and hold the mapping index plus one, zero is empty
+//
+static GLFWbool buildMappingIndex(int size)
 {
     int i;
+    int* index = _glfw_calloc(size, sizeof(int));
+    if (!index)
+        return GLFW_FALSE;
 
     for (i = 0;  i < _glfw.mappingCount;  i++)
     {
-        if (strcmp(_glfw.mappings[i].guid, guid) == 0)
-            return _glfw.mappings + i;
+        uint32_t slot = hashMappingGUID(_glfw.mappings[i].guid) & (size - 1);
+        while (index[slot])
+            slot = (slot + 1) & (size - 1);
+
+        index[slot] = i + 1;
+    }
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = index;
+    _glfw.mappingIndexSize = size;
+    return GLFW_TRUE;
+}
+
+// Finds a mapping based on joystick GUID
+//
+static _GLFWmapping* findMapping(const char* guid)
+{
+    uint32_t slot;
+
+    if (!_glfw.mappingIndexSize)
+        return NULL;
+
+    slot = hashMappingGUID(guid) & (_glfw.mappingIndexSize - 1);
+    while (_glfw.mappingIndex[slot])
+    {
+        _GLFWmapping* mapping = _glfw.mappings + _glfw.mappingIndex[slot] - 1;
+        if (strcmp(mapping->guid, guid) == 0)
+            return mapping;
+
+        slot = (slot + 1) & (_glfw.mappingIndexSize - 1);
     }
 
     return NULL;
 }
 
+// Adds a mapping or replaces the existing one with the same GUID
+// This may move the mapping array, so joystick mapping pointers must be updated
+//
+static GLFWbool addMapping(const _GLFWmapping* mapping)
+{
+    _GLFWmapping* previous = findMapping(mapping->guid);
+    if (previous)
+    {
+        *previous = *mapping;
+        return GLFW_TRUE;
+    }
+
+    if (_glfw.mappingCount == _glfw.mappingCapacity)
+    {
+        const int capacity = _glfw.mappingCapacity ? _glfw.mappingCapacity * 2 : 64;
+        _GLFWmapping* mappings =
+            _glfw_realloc(_glfw.mappings, sizeof(_GLFWmapping) * capacity);
+        if (!mappings)
+            return GLFW_FALSE;
+
+        _glfw.mappings = mappings;
+        _glfw.mappingCapacity = capacity;
+    }
+
+    _glfw.mappings[_glfw.mappingCount++] = *mapping;
+
+    // Keep the index at most half full
+    if (_glfw.mappingCount * 2 > _glfw.mappingIndexSize)
+    {
+        const int size = _glfw.mappingIndexSize ? _glfw.mappingIndexSize * 2 : 128;
+        if (!buildMappingIndex(size))
+        {
+            _glfw.mappingCount--;
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        uint32_t slot = hashMappingGUID(mapping->guid) & (_glfw.mappingIndexSize - 1);
+        while (_glfw.mappingIndex[slot])
+            slot = (slot + 1) & (_glfw.mappingIndexSize - 1);
+
+        _glfw.mappingIndex[slot] = _glfw.mappingCount;
+    }
+
+    return GLFW_TRUE;
+}
+
 // Checks whether a gamepad mapping element is present in the hardware
 //
 static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
@@ -120,7 +212,22 @@ static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
     return mapping;
 }
 
+// Parses the decimal number following the current character
+//
+static unsigned long parseIndex(const char** c)
+{
+    unsigned long value = 0;
+    const char* p = *c + 1;
+
+    while (*p >= '0' && *p <= '9')
+        value = value * 10 + (unsigned long) (*p++ - '0');
+
+    *c = p;
+    return value;
+}
+
 // Parses an SDL_GameControllerDB line and adds it to the mapping list
+// The line ends at the first newline or at the end of the string
 //
 static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 {
@@ -156,7 +263,7 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
         { "righty",        mapping->axes + GLFW_GAMEPAD_AXIS_RIGHT_Y }
     };
 
-    length = strcspn(c, ",");
+    length = strcspn(c, ",\r\n");
     if (length != 32 || c[length] != ',')
     {
         _glfwInputError(GLFW_INVALID_VALUE, NULL);
@@ -166,7 +273,7 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
     memcpy(mapping->guid, c, length);
     c += length + 1;
 
-    length = strcspn(c, ",");
+    length = strcspn(c, ",\r\n");
     if (length >= sizeof(mapping->name) || c[length] != ',')
     {
         _glfwInputError(GLFW_INVALID_VALUE, NULL);
@@ -176,16 +283,19 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
     memcpy(mapping->name, c, length);
     c += length + 1;
 
-    while (*c)
+    while (*c && *c != '\r' && *c != '\n')
     {
         // TODO: Implement output modifiers
         if (*c == '+' || *c == '-')
             return GLFW_FALSE;
 
-        for (i = 0;  i < sizeof(fields) / sizeof(fields[0]);  i++)
+        // Compare the element name as a whole instead of prefix matching every field
+        for (length = 0;  c[length] && c[length] != ':' && c[length] != ',' && c[length] != '\r' && c[length] != '\n';  length++)
+            ;
+
+        for (i = 0;  c[length] == ':' && i < sizeof(fields) / sizeof(fields[0]);  i++)
         {
-            length = strlen(fields[i].name);
-            if (strncmp(c, fields[i].name, length) != 0 || c[length] != ':')
+            if (fields[i].name[0] != c[0] || strlen(fields[i].name) != length || memcmp(c, fields[i].name, length) != 0)
                 continue;
 
             c += length + 1;
@@ -218,12 +328,12 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 
                 if (e->type == _GLFW_JOYSTICK_HATBIT)
                 {
-                    const unsigned long hat = strtoul(c + 1, (char**) &c, 10);
-                    const unsigned long bit = strtoul(c + 1, (char**) &c, 10);
+                    const unsigned long hat = parseIndex(&c);
+                    const unsigned long bit = parseIndex(&c);
                     e->index = (uint8_t) ((hat << 4) | bit);
                 }
                 else
-                    e->index = (uint8_t) strtoul(c + 1, (char**) &c, 10);
+                    e->index = (uint8_t) parseIndex(&c);
 
                 if (e->type == _GLFW_JOYSTICK_AXIS)
                 {
@@ -248,8 +358,10 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
             break;
         }
 
-        c += strcspn(c, ",");
-        c += strspn(c, ",");
+        while (*c && *c != ',' && *c != '\r' && *c != '\n')
+            c++;
+        while (*c == ',')
+            c++;
     }
 
     for (i = 0;  i < 32;  i++)
@@ -486,14 +598,24 @@ void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
 void _glfwInitGamepadMappings(void)
 {
     size_t i;
+    int size = 128;
     const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
     _glfw.mappings = _glfw_calloc(count, sizeof(_GLFWmapping));
+    if (!_glfw.mappings)
+        return;
+
+    _glfw.mappingCapacity = (int) count;
 
     for (i = 0;  i < count;  i++)
     {
         if (parseMapping(&_glfw.mappings[_glfw.mappingCount], _glfwDefaultMappings[i]))
             _glfw.mappingCount++;
     }
+
+    while (size < _glfw.mappingCount * 2)
+        size *= 2;
+
+    buildMappingIndex(size);
 }
 
 // Returns an available joystick object with arrays and name allocated
@@ -1266,33 +1388,16 @@ GLFWAPI int glfwUpdateGamepadMappings(const char* string)
             (*c >= 'a' && *c <= 'f') ||
             (*c >= 'A' && *c <= 'F'))
         {
-            char line[1024];
+            // Lines are parsed in place, without copying them out of the string
+            _GLFWmapping mapping = {{0}};
 
-            const size_t length = strcspn(c, "\r\n");
-            if (length < sizeof(line))
+            if (parseMapping(&mapping, c))
             {
-                _GLFWmapping mapping = {{0}};
-
-                memcpy(line, c, length);
-                line[length] = '\0';
-
-                if (parseMapping(&mapping, line))
-                {
-                    _GLFWmapping* previous = findMapping(mapping.guid);
-                    if (previous)
-                        *previous = mapping;
-                    else
-                    {
-                        _glfw.mappingCount++;
-                        _glfw.mappings =
-                            _glfw_realloc(_glfw.mappings,
-                                          sizeof(_GLFWmapping) * _glfw.mappingCount);
-                        _glfw.mappings[_glfw.mappingCount - 1] = mapping;
-                    }
-                }
+                if (!addMapping(&mapping))
+                    break;
             }
 
-            c += length;
+            c += strcspn(c, "\r\n");
         }
         else
         {
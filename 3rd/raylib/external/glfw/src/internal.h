@@ -779,6 +779,9 @@ struct _GLFWlibrary
     _GLFWjoystick       joysticks[GLFW_JOYSTICK_LAST + 1];
     _GLFWmapping*       mappings;
     int                 mappingCount;
+    int                 mappingCapacity;
+    int*                mappingIndex;
+    int                 mappingIndexSize;
 
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
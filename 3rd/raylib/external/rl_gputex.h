@@ -1,6 +1,6 @@
 /**********************************************************************************************
 *
-*   rl_gputex v1.1 - GPU compressed textures loading and saving
+*   rl_gputex v1.2 - GPU compressed textures loading and saving
 *
 *   DESCRIPTION:
 *
@@ -14,18 +14,30 @@
 *     - rl_save_ktx_to_memory() requires rlGetGlTextureFormats() from rlgl.h
 *         though this is not a problem, if you don't need KTX support
 *
-*   TODO:
-*     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
-*
 *   CONFIGURATION:
 *
 *   #define RL_GPUTEX_SUPPORT_DDS
 *   #define RL_GPUTEX_SUPPORT_PKM
 *   #define RL_GPUTEX_SUPPORT_KTX
+*   #define RL_GPUTEX_SUPPORT_KTX2
 *   #define RL_GPUTEX_SUPPORT_PVR
 *   #define RL_GPUTEX_SUPPORT_ASTC
 *       Define desired file formats to be supported
 *
+*   #define RL_GPUTEX_ZSTD_DECOMPRESS(dst, dst_size, src, src_size)
+*   #define RL_GPUTEX_ZLIB_DECOMPRESS(dst, dst_size, src, src_size)
+*       Define to inflate Zstandard/ZLIB supercompressed KTX2 levels, must return
+*       the number of bytes written into dst (i.e. ZSTD_decompress(), zsinflate())
+*
+*   #define RL_GPUTEX_BASIS_TRANSCODE(file_data, file_size, level, format, dst, dst_size)
+*       Define to transcode Basis Universal (ETC1S/UASTC) KTX2 levels into the requested
+*       rlGpuTexPixelFormat, must return non-zero on success (i.e. basist::ktx2_transcoder)
+*       NOTE: Called concurrently for different levels when compiled with OpenMP
+*
+*   #define RL_GPUTEX_FORMAT_SUPPORTED(format)
+*       Define to report GPU support for a rlGpuTexPixelFormat, used to select the Basis
+*       Universal transcode target; not doing so always transcodes to R8G8B8A8
+*
 *   #define RL_GPUTEX_SHOW_LOG_INFO
 *       Define, if you wish to see warnings generated by the library
 *       This will include <stdio.h> unless you provide your own RL_GPUTEX_LOG
@@ -53,6 +65,9 @@
 *       There is no need to do so when statically linking
 *
 *   VERSIONS HISTORY:
+*       1.2 (19-Oct-2026) Added KTX2 loading: uncompressed, BCn, ETC2 and ASTC levels, Zstandard/ZLIB
+*           supercompression and Basis Universal transcoding through user provided decoders
+*
 *       1.1 (15-Jul-2025) Several minor fixes related to specific image formats; some work has been done
 *           in order to decouple the library from Raylib by introducing few new macros; library still
 *           requires Raylib in order to function properly
@@ -130,6 +145,7 @@ extern "C" {            // Prevents name mangling of functions
 RLGPUTEXAPI void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLGPUTEXAPI void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLGPUTEXAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
+RLGPUTEXAPI void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLGPUTEXAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLGPUTEXAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
@@ -693,6 +709,306 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 }
 #endif
 
+#if defined(RL_GPUTEX_SUPPORT_KTX2)
+// Get KTX2 level data size in bytes, rounding up to full blocks for compressed formats
+static int get_ktx2_level_data_size(int width, int height, int format)
+{
+    int block_bytes = 0;
+
+    switch (format)
+    {
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB: block_bytes = 8; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: block_bytes = 16; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return ((width + 7)/8)*((height + 7)/8)*16;
+        default: return get_pixel_data_size(width, height, format);
+    }
+
+    return ((width + 3)/4)*((height + 3)/4)*block_bytes;
+}
+
+// Load KTX2 image data (uncompressed, BCn, ETC2, ASTC or Basis Universal payloads)
+// NOTE: Only 2D textures are supported, mipmap levels are returned largest first as for other formats
+// Zstandard/Zlib supercompressed levels are inflated with RL_GPUTEX_ZSTD_DECOMPRESS/RL_GPUTEX_ZLIB_DECOMPRESS,
+// Basis Universal (ETC1S/UASTC) levels are transcoded with RL_GPUTEX_BASIS_TRANSCODE to the first format
+// accepted by RL_GPUTEX_FORMAT_SUPPORTED: ASTC 4x4, DXT5/DXT1, ETC2 or R8G8B8A8 as fallback
+// Levels are processed in parallel when compiled with OpenMP
+void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    void *image_data = RL_GPUTEX_NULL;        // Image data pointer
+
+    // KTX2 file Header (80 bytes)
+    // v2.0 - https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+    typedef struct {
+        unsigned char id[12];                   // Identifier: "«KTX 20»\r\n\x1A\n"
+        unsigned int vk_format;                 // VkFormat, VK_FORMAT_UNDEFINED (0) for Basis Universal
+        unsigned int type_size;                 // Size of the data type in bytes, 1 for block-compressed
+        unsigned int width;                     // Texture image width in pixels
+        unsigned int height;                    // Texture image height in pixels
+        unsigned int depth;                     // For 2D textures is 0
+        unsigned int layers;                    // Number of array layers, no array = 0
+        unsigned int faces;                     // Cubemap faces, for no-cubemap = 1
+        unsigned int levels;                    // Mipmap levels, 0 = generate at load
+        unsigned int supercompression;          // 0 = None, 1 = BasisLZ, 2 = Zstandard, 3 = ZLIB
+        unsigned int dfd_offset;                // Data Format Descriptor offset
+        unsigned int dfd_size;                  // Data Format Descriptor size
+        unsigned int kvd_offset;                // Key/Value data offset
+        unsigned int kvd_size;                  // Key/Value data size
+        unsigned long long sgd_offset;          // Supercompression global data offset
+        unsigned long long sgd_size;            // Supercompression global data size
+    } ktx2_header;
+
+    // KTX2 level index entry, one per mipmap level (largest first)
+    typedef struct {
+        unsigned long long offset;              // Level data offset in file
+        unsigned long long size;                // Level data size in file (supercompressed)
+        unsigned long long uncompressed_size;   // Level data size once inflated
+    } ktx2_level;
+
+    static const unsigned char ktx2_identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    if ((file_data == RL_GPUTEX_NULL) || (file_size < sizeof(ktx2_header))) return image_data;
+
+    const ktx2_header *header = (const ktx2_header *)file_data;
+
+    int valid = 1;
+    for (int i = 0; i < 12; i++) if (header->id[i] != ktx2_identifier[i]) valid = 0;
+
+    if (!valid)
+    {
+        RL_GPUTEX_LOG("KTX2 file data not valid");
+        return image_data;
+    }
+
+    if ((header->depth > 1) || (header->layers > 1) || (header->faces != 1))
+    {
+        RL_GPUTEX_LOG("KTX2 only 2D textures supported (depth: %i, layers: %i, faces: %i)", header->depth, header->layers, header->faces);
+        return image_data;
+    }
+
+    // NOTE: Largest pixel format is 16 bytes per pixel, level sizes must fit in int
+    if ((header->width == 0) || (header->height == 0) || ((unsigned long long)header->width*header->height*16 > 0x7fffffff))
+    {
+        RL_GPUTEX_LOG("KTX2 image dimensions not valid (%ix%i)", header->width, header->height);
+        return image_data;
+    }
+
+    int level_count = (header->levels == 0)? 1 : (int)header->levels;
+    if (sizeof(ktx2_header) + level_count*sizeof(ktx2_level) > file_size)
+    {
+        RL_GPUTEX_LOG("KTX2 level index not valid");
+        return image_data;
+    }
+
+    const ktx2_level *levels = (const ktx2_level *)(file_data + sizeof(ktx2_header));
+
+    for (int i = 0; i < level_count; i++)
+    {
+        if ((levels[i].offset > file_size) || (levels[i].size > file_size - levels[i].offset))
+        {
+            RL_GPUTEX_LOG("KTX2 level %i data out of file bounds", i);
+            return image_data;
+        }
+    }
+
+    // Basis Universal payloads: ETC1S is always BasisLZ supercompressed,
+    // UASTC is identified by the Data Format Descriptor color model
+    int basis = 0;                      // 1 = ETC1S, 2 = UASTC
+    int basis_alpha = 0;
+
+    if ((header->vk_format == 0) && (header->dfd_size >= 44) && (header->dfd_offset <= file_size) && (header->dfd_size <= file_size - header->dfd_offset))
+    {
+        const unsigned char *dfd = file_data + header->dfd_offset;
+        unsigned int color_model = dfd[12];                                 // Basic descriptor block: colorModel
+        unsigned int block_size = dfd[10] | (dfd[11] << 8);                 // Basic descriptor block: descriptorBlockSize
+        unsigned int sample_count = (block_size > 24)? (block_size - 24)/16 : 0;
+        unsigned int channel_id = dfd[28 + 3] & 0x0f;                      // First sample: channelType
+
+        if ((color_model == 163) || (header->supercompression == 1))       // KHR_DF_MODEL_ETC1S
+        {
+            basis = 1;
+            basis_alpha = (sample_count > 1);                               // Second slice holds alpha
+        }
+        else if (color_model == 166)                                        // KHR_DF_MODEL_UASTC
+        {
+            basis = 2;
+            basis_alpha = (channel_id == 3) || (channel_id == 5);           // UASTC RGBA or RRRG
+        }
+    }
+
+    // Map image format
+    int image_format = 0;
+
+    if (basis)
+    {
+        // Select best transcode target supported by the GPU
+        int targets[5] = {
+            RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,
+            basis_alpha? RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA : RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB,
+            basis_alpha? RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA : RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB,
+            RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 0
+        };
+
+        for (int i = 0; (targets[i] != 0) && (image_format == 0); i++)
+        {
+            if (targets[i] == RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) image_format = targets[i];
+        #if defined(RL_GPUTEX_FORMAT_SUPPORTED)
+            else if (RL_GPUTEX_FORMAT_SUPPORTED(targets[i])) image_format = targets[i];
+        #endif
+        }
+    }
+    else
+    {
+        switch (header->vk_format)
+        {
+            case 9: case 15: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;         // VK_FORMAT_R8_UNORM/SRGB
+            case 16: case 22: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;       // VK_FORMAT_R8G8_UNORM/SRGB
+            case 4: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;                     // VK_FORMAT_R5G6B5_UNORM_PACK16
+            case 23: case 29: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;           // VK_FORMAT_R8G8B8_UNORM/SRGB
+            case 6: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;                   // VK_FORMAT_R5G5B5A1_UNORM_PACK16
+            case 2: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;                   // VK_FORMAT_R4G4B4A4_UNORM_PACK16
+            case 37: case 43: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;         // VK_FORMAT_R8G8B8A8_UNORM/SRGB
+            case 100: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32; break;                      // VK_FORMAT_R32_SFLOAT
+            case 106: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;                // VK_FORMAT_R32G32B32_SFLOAT
+            case 109: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;             // VK_FORMAT_R32G32B32A32_SFLOAT
+            case 76: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16; break;                       // VK_FORMAT_R16_SFLOAT
+            case 90: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16; break;                 // VK_FORMAT_R16G16B16_SFLOAT
+            case 97: image_format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16; break;              // VK_FORMAT_R16G16B16A16_SFLOAT
+            case 131: case 132: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB; break;         // VK_FORMAT_BC1_RGB_UNORM/SRGB_BLOCK
+            case 133: case 134: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;        // VK_FORMAT_BC1_RGBA_UNORM/SRGB_BLOCK
+            case 135: case 136: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;        // VK_FORMAT_BC2_UNORM/SRGB_BLOCK
+            case 137: case 138: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;        // VK_FORMAT_BC3_UNORM/SRGB_BLOCK
+            case 147: case 148: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB; break;         // VK_FORMAT_ETC2_R8G8B8_UNORM/SRGB_BLOCK
+            case 151: case 152: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;    // VK_FORMAT_ETC2_R8G8B8A8_UNORM/SRGB_BLOCK
+            case 157: case 158: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;    // VK_FORMAT_ASTC_4x4_UNORM/SRGB_BLOCK
+            case 171: case 172: image_format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;    // VK_FORMAT_ASTC_8x8_UNORM/SRGB_BLOCK
+            default: break;
+        }
+
+        if (image_format == 0)
+        {
+            RL_GPUTEX_LOG("KTX2 VkFormat not supported (%i)", header->vk_format);
+            return image_data;
+        }
+    }
+
+#if !defined(RL_GPUTEX_BASIS_TRANSCODE)
+    if (basis)
+    {
+        RL_GPUTEX_LOG("KTX2 Basis Universal data requires RL_GPUTEX_BASIS_TRANSCODE");
+        return image_data;
+    }
+#endif
+#if !defined(RL_GPUTEX_ZSTD_DECOMPRESS)
+    if (!basis && (header->supercompression == 2))
+    {
+        RL_GPUTEX_LOG("KTX2 Zstandard supercompression requires RL_GPUTEX_ZSTD_DECOMPRESS");
+        return image_data;
+    }
+#endif
+#if !defined(RL_GPUTEX_ZLIB_DECOMPRESS)
+    if (header->supercompression == 3)
+    {
+        RL_GPUTEX_LOG("KTX2 ZLIB supercompression requires RL_GPUTEX_ZLIB_DECOMPRESS");
+        return image_data;
+    }
+#endif
+    if (!basis && (header->supercompression != 0) && (header->supercompression != 2) && (header->supercompression != 3))
+    {
+        RL_GPUTEX_LOG("KTX2 supercompression scheme not supported (%i)", header->supercompression);
+        return image_data;
+    }
+
+    // Compute every level output offset first, so levels can be filled independently
+    // NOTE: Output levels are packed with the size expected for their dimensions (as read on upload),
+    // mipmap chain is cut at the first level providing less data than expected
+    unsigned long long level_offsets[32] = { 0 };
+    unsigned long long data_size = 0;
+
+    if (level_count > 32) level_count = 32;
+
+    for (int i = 0; i < level_count; i++)
+    {
+        int level_width = ((header->width >> i) > 0)? (header->width >> i) : 1;
+        int level_height = ((header->height >> i) > 0)? (header->height >> i) : 1;
+        unsigned long long level_size = (unsigned long long)get_ktx2_level_data_size(level_width, level_height, image_format);
+
+        if (!basis && (((header->supercompression == 0)? levels[i].size : levels[i].uncompressed_size) < level_size))
+        {
+            RL_GPUTEX_LOG("KTX2 level %i data smaller than expected, mipmap chain truncated", i);
+            level_count = i;
+            break;
+        }
+
+        level_offsets[i] = data_size;
+        data_size += level_size;
+    }
+
+    if ((data_size == 0) || (data_size > 0x7fffffff))
+    {
+        RL_GPUTEX_LOG("KTX2 image data size not valid");
+        return image_data;
+    }
+
+    image_data = RL_GPUTEX_MALLOC((size_t)data_size);
+
+    int failed_level = -1;
+    int i = 0;
+
+#if defined(_OPENMP)
+    #pragma omp parallel for schedule(dynamic, 1) if (level_count > 1)
+#endif
+    for (i = 0; i < level_count; i++)
+    {
+        unsigned char *level_data = (unsigned char *)image_data + level_offsets[i];
+        int level_data_size = (int)(((i + 1 < level_count)? level_offsets[i + 1] : data_size) - level_offsets[i]);
+        const unsigned char *src = file_data + levels[i].offset;
+        int result = level_data_size;
+
+        if (basis)
+        {
+        #if defined(RL_GPUTEX_BASIS_TRANSCODE)
+            result = RL_GPUTEX_BASIS_TRANSCODE(file_data, file_size, i, image_format, level_data, level_data_size)? level_data_size : -1;
+        #endif
+        }
+        else if (header->supercompression == 0) RL_GPUTEX_MEMCPY(level_data, src, level_data_size);
+    #if defined(RL_GPUTEX_ZSTD_DECOMPRESS)
+        else if (header->supercompression == 2) result = RL_GPUTEX_ZSTD_DECOMPRESS(level_data, level_data_size, src, (int)levels[i].size);
+    #endif
+    #if defined(RL_GPUTEX_ZLIB_DECOMPRESS)
+        else if (header->supercompression == 3) result = RL_GPUTEX_ZLIB_DECOMPRESS(level_data, level_data_size, src, (int)levels[i].size);
+    #endif
+
+        if (result != level_data_size)
+        {
+        #if defined(_OPENMP)
+            #pragma omp critical
+        #endif
+            failed_level = i;
+        }
+    }
+
+    if (failed_level >= 0)
+    {
+        RL_GPUTEX_LOG("KTX2 level %i data could not be %s", failed_level, basis? "transcoded" : "decompressed");
+        RL_GPUTEX_FREE(image_data);
+        return RL_GPUTEX_NULL;
+    }
+
+    *width = header->width;
+    *height = header->height;
+    *format = image_format;
+    *mips = level_count;
+
+    return image_data;
+}
+#endif
+
 #if defined(RL_GPUTEX_SUPPORT_PVR)
 // Loading PVR image data (uncompressed or PVRT compression)
 // NOTE: PVR v2 not supported, use PVR v3 instead
@@ -917,6 +1233,9 @@ static int get_pixel_data_size(int width, int height, int format)
         case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
         case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
         case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB:
@@ -931,7 +1250,7 @@ static int get_pixel_data_size(int width, int height, int format)
         default: break;
     }
 
-    data_size = width*height*bpp/8;  // Total data size in bytes
+    data_size = (int)((long long)width*height*bpp/8);  // Total data size in bytes
 
     // Most compressed formats works on 4x4 blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
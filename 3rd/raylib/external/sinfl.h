@@ -132,6 +132,26 @@ struct sinfl {
 extern int sinflate(void *out, int cap, const void *in, int size);
 extern int zsinflate(void *out, int cap, const void *in, int size);
 
+/* Incremental decompression: `sinfl_stream_inflate` resumes writing at
+ * `out + total` and stops with SINFL_STREAM_FULL when `cap` is reached,
+ * in which case the caller can move the bytes written so far into a larger
+ * buffer and call it again. Previous output must be kept in place since
+ * back-references can reach up to 32KB behind the current position. */
+enum sinfl_stream_result {
+  SINFL_STREAM_ERROR = -1,
+  SINFL_STREAM_DONE = 0,
+  SINFL_STREAM_FULL = 1
+};
+enum sinfl_states {SINFL_HDR,SINFL_STORED,SINFL_FIXED,SINFL_DYN,SINFL_BLK,SINFL_END};
+struct sinfl_stream {
+  struct sinfl s;
+  int state;
+  int last;
+  int total;      /* bytes written to output so far */
+};
+extern void sinfl_stream_init(struct sinfl_stream *z, const void *in, int size);
+extern int sinfl_stream_inflate(struct sinfl_stream *z, void *out, int cap);
+
 #ifdef __cplusplus
 }
 #endif
@@ -253,6 +273,11 @@ sinfl_get(struct sinfl *s, int cnt) {
   sinfl_refill(s);
   return sinfl__get(s, cnt);
 }
+struct sinfl_mark {
+  const unsigned char *bitptr;
+  unsigned long long bitbuf;
+  int bitcnt;
+};
 struct sinfl_gen {
   int len;
   int cnt;
@@ -380,8 +405,20 @@ sinfl_decode(struct sinfl *s, const unsigned *tbl, int bit_len) {
   sinfl_eat(s, key & 0x0f);
   return (key >> 16) & 0x0fff;
 }
+static void
+sinfl_mark(const struct sinfl *s, struct sinfl_mark *m) {
+  m->bitptr = s->bitptr;
+  m->bitbuf = s->bitbuf;
+  m->bitcnt = s->bitcnt;
+}
+static void
+sinfl_rewind(struct sinfl *s, const struct sinfl_mark *m) {
+  s->bitptr = m->bitptr;
+  s->bitbuf = m->bitbuf;
+  s->bitcnt = m->bitcnt;
+}
 static int
-sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+sinfl_decompress(struct sinfl_stream *z, unsigned char *o, int cap) {
   static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
   static const short dbase[30+2] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
       257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
@@ -392,49 +429,54 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
   static const unsigned char lbits[29+2] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,
       4,4,4,5,5,5,5,0,0,0};
 
-  const unsigned char *oe = out + cap;
-  const unsigned char *e = in + size, *o = out;
-  enum sinfl_states {hdr,stored,fixed,dyn,blk};
-  enum sinfl_states state = hdr;
-  struct sinfl s = {0};
-  int last = 0;
+  const unsigned char *oe = o + cap;
+  unsigned char *out = o + z->total;
+  struct sinfl *s = &z->s;
+  struct sinfl_mark m;
+  int res = SINFL_STREAM_ERROR;
 
-  s.bitptr = in;
-  s.bitend = e;     // @raysan5: added
   while (1) {
-    switch (state) {
-    case hdr: {
+    if (sinfl_unlikely(s->bitcnt < 0)) {
+      /* ran past the end of the input */
+      goto done;
+    }
+    switch (z->state) {
+    case SINFL_HDR: {
       /* block header */
       int type = 0;
-      sinfl_refill(&s);
-      last = sinfl__get(&s,1);
-      type = sinfl__get(&s,2);
-
-      switch (type) {default: return (int)(out-o);
-      case 0x00: state = stored; break;
-      case 0x01: state = fixed; break;
-      case 0x02: state = dyn; break;}
+      sinfl_refill(s);
+      z->last = sinfl__get(s,1);
+      type = sinfl__get(s,2);
+
+      switch (type) {default: goto done;
+      case 0x00: z->state = SINFL_STORED; break;
+      case 0x01: z->state = SINFL_FIXED; break;
+      case 0x02: z->state = SINFL_DYN; break;}
     } break;
-    case stored: {
+    case SINFL_STORED: {
       /* uncompressed block */
       unsigned len, nlen;
-      sinfl__get(&s,s.bitcnt & 7);
-      len = (unsigned short)sinfl__get(&s,16);
-      nlen = (unsigned short)sinfl__get(&s,16);
-      s.bitptr -= s.bitcnt / 8;
-      s.bitbuf = s.bitcnt = 0;
+      sinfl_mark(s, &m);
+      sinfl__get(s,s->bitcnt & 7);
+      len = (unsigned short)sinfl__get(s,16);
+      nlen = (unsigned short)sinfl__get(s,16);
+      s->bitptr -= s->bitcnt / 8;
+      s->bitbuf = s->bitcnt = 0;
 
       if ((unsigned short)len != (unsigned short)~nlen)
-        return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
-        return (int)(out-o);
-
-      memcpy(out, s.bitptr, (size_t)len);
-      s.bitptr += len, out += len;
-      if (last) return (int)(out-o);
-      state = hdr;
+        goto done;
+      if (len > (unsigned)(s->bitend - s->bitptr))
+        goto done;
+      if (len > (unsigned)(oe - out)) {
+        sinfl_rewind(s, &m);
+        res = SINFL_STREAM_FULL;
+        goto done;
+      }
+      memcpy(out, s->bitptr, (size_t)len);
+      s->bitptr += len, out += len;
+      z->state = z->last ? SINFL_END : SINFL_HDR;
     } break;
-    case fixed: {
+    case SINFL_FIXED: {
       /* fixed huffman codes */
       int n; unsigned char lens[288+32];
       for (n = 0; n <= 143; n++) lens[n] = 8;
@@ -444,75 +486,85 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       for (n = 0; n < 32; n++) lens[288+n] = 5;
 
       /* build lit/dist tables */
-      sinfl_build(s.lits, lens, 10, 15, 288);
-      sinfl_build(s.dsts, lens + 288, 8, 15, 32);
-      state = blk;
+      sinfl_build(s->lits, lens, 10, 15, 288);
+      sinfl_build(s->dsts, lens + 288, 8, 15, 32);
+      z->state = SINFL_BLK;
     } break;
-    case dyn: {
+    case SINFL_DYN: {
       /* dynamic huffman codes */
       int n, i;
       unsigned hlens[SINFL_PRE_TBL_SIZE];
       unsigned char nlens[19] = {0}, lens[288+32];
 
-      sinfl_refill(&s);
-      {int nlit = 257 + sinfl__get(&s,5);
-      int ndist = 1 + sinfl__get(&s,5);
-      int nlen = 4 + sinfl__get(&s,4);
+      sinfl_refill(s);
+      {int nlit = 257 + sinfl__get(s,5);
+      int ndist = 1 + sinfl__get(s,5);
+      int nlen = 4 + sinfl__get(s,4);
       for (n = 0; n < nlen; n++)
-        nlens[order[n]] = (unsigned char)sinfl_get(&s,3);
+        nlens[order[n]] = (unsigned char)sinfl_get(s,3);
       sinfl_build(hlens, nlens, 7, 7, 19);
 
       /* decode code lengths */
       for (n = 0; n < nlit + ndist;) {
         int sym = 0;
-        sinfl_refill(&s);
-        sym = sinfl_decode(&s, hlens, 7);
-        switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        if (sinfl_unlikely(s->bitcnt < 0))
+          goto done;
+        sinfl_refill(s);
+        sym = sinfl_decode(s, hlens, 7);
+        switch (sym) {default: lens[n++] = (unsigned char)sym; continue;
+        case 16: if (!n) goto done; i = 3+sinfl_get(s,2); break;
+        case 17: i = 3+sinfl_get(s,3); break;
+        case 18: i = 11+sinfl_get(s,7); break;}
+        if (n + i > nlit + ndist)
+          goto done;
+        for (; i; i--,n++) lens[n] = sym == 16 ? lens[n-1] : 0;
       }
       /* build lit/dist tables */
-      sinfl_build(s.lits, lens, 10, 15, nlit);
-      sinfl_build(s.dsts, lens + nlit, 8, 15, ndist);
-      state = blk;}
+      sinfl_build(s->lits, lens, 10, 15, nlit);
+      sinfl_build(s->dsts, lens + nlit, 8, 15, ndist);
+      z->state = SINFL_BLK;}
     } break;
-    case blk: {
+    case SINFL_BLK: {
       /* decompress block */
       while (1) {
         int sym;
-        sinfl_refill(&s);
-        sym = sinfl_decode(&s, s.lits, 10);
+        if (sinfl_unlikely(s->bitcnt < 0))
+          goto done;
+        sinfl_mark(s, &m);
+        sinfl_refill(s);
+        sym = sinfl_decode(s, s->lits, 10);
         if (sym < 256) {
           /* literal */
           if (sinfl_unlikely(out >= oe)) {
-            return (int)(out-o);
+            sinfl_rewind(s, &m);
+            res = SINFL_STREAM_FULL;
+            goto done;
           }
           *out++ = (unsigned char)sym;
-          sym = sinfl_decode(&s, s.lits, 10);
-          if (sym < 256) {
-            *out++ = (unsigned char)sym;
-            continue;
-          }
+          continue;
         }
         if (sinfl_unlikely(sym == 256)) {
           /* end of block */
-          if (last) return (int)(out-o);
-          state = hdr;
+          z->state = z->last ? SINFL_END : SINFL_HDR;
           break;
         }
         /* match */
         if (sym >= 286) {
           /* length codes 286 and 287 must not appear in compressed data */
-          return (int)(out-o);
+          goto done;
         }
         sym -= 257;
-        {int len = sinfl__get(&s, lbits[sym]) + lbase[sym];
-        int dsym = sinfl_decode(&s, s.dsts, 8);
-        int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
+        {int len = sinfl__get(s, lbits[sym]) + lbase[sym];
+        int dsym = sinfl_decode(s, s->dsts, 8);
+        int offs = sinfl__get(s, dbits[dsym]) + dbase[dsym];
         unsigned char *dst = out, *src = out - offs;
         if (sinfl_unlikely(offs > (int)(out-o))) {
-          return (int)(out-o);
+          goto done;
+        }
+        if (sinfl_unlikely(len > (int)(oe-out))) {
+          sinfl_rewind(s, &m);
+          res = SINFL_STREAM_FULL;
+          goto done;
         }
         out = out + len;
 
@@ -578,13 +630,34 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           while (dst < out);
         }}
       }
-    } break;}
+    } break;
+    case SINFL_END:
+      res = SINFL_STREAM_DONE;
+      goto done;
+    }
   }
-  return (int)(out-o);
+done:
+  z->total = (int)(out-o);
+  return res;
+}
+extern void
+sinfl_stream_init(struct sinfl_stream *z, const void *in, int size) {
+  memset(z, 0, sizeof(*z));
+  z->s.bitptr = (const unsigned char*)in;
+  z->s.bitend = (const unsigned char*)in + size;
+  z->state = SINFL_HDR;
+}
+extern int
+sinfl_stream_inflate(struct sinfl_stream *z, void *out, int cap) {
+  if (z->total > cap) return SINFL_STREAM_ERROR;
+  return sinfl_decompress(z, (unsigned char*)out, cap);
 }
 extern int
 sinflate(void *out, int cap, const void *in, int size) {
-  return sinfl_decompress((unsigned char*)out, cap, (const unsigned char*)in, size);
+  struct sinfl_stream z;
+  sinfl_stream_init(&z, in, size);
+  sinfl_decompress(&z, (unsigned char*)out, cap);
+  return z.total;
 }
 static unsigned
 sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -618,7 +691,7 @@ zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
+    int n = sinflate(out, cap, in + 2u, size - 2);
     unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
@@ -44,6 +44,9 @@ revision history:
     1.02  (2021-09-10)  @raysan5: Reviewed some formating
     1.03  (2021-10-02)  @catmanl: Reduce warnings on gcc
     1.04  (2021-10-17)  @warzes: Fixing the error of loading VOX models
+    1.05  (2026-10-19)  Chunk bitmask face culling and greedy meshing, chunks
+                        meshed in parallel when compiled with OpenMP
+                        Define VOX_LOADER_SIMPLE_MESHING for one quad per voxel face
 
 */
 
@@ -170,6 +173,7 @@ static void initArrayUShort(ArrayUShort* a, int initialSize)
 	a->size = initialSize;
 }
 
+#if defined(VOX_LOADER_SIMPLE_MESHING)
 static void insertArrayUShort(ArrayUShort* a, unsigned short element)
 {
 	if (a->used == a->size)
@@ -179,6 +183,7 @@ static void insertArrayUShort(ArrayUShort* a, unsigned short element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayUShort(ArrayUShort* a)
 {
@@ -199,6 +204,7 @@ static void initArrayVector3(ArrayVector3* a, int initialSize)
 	a->size = initialSize;
 }
 
+#if defined(VOX_LOADER_SIMPLE_MESHING)
 static void insertArrayVector3(ArrayVector3* a, VoxVector3 element)
 {
 	if (a->used == a->size)
@@ -208,6 +214,7 @@ static void insertArrayVector3(ArrayVector3* a, VoxVector3 element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayVector3(ArrayVector3* a)
 {
@@ -227,6 +234,7 @@ static void initArrayColor(ArrayColor* a, int initialSize)
 	a->size = initialSize;
 }
 
+#if defined(VOX_LOADER_SIMPLE_MESHING)
 static void insertArrayColor(ArrayColor* a, VoxColor element)
 {
 	if (a->used == a->size)
@@ -236,6 +244,7 @@ static void insertArrayColor(ArrayColor* a, VoxColor element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayColor(ArrayColor* a)
 {
@@ -383,6 +392,7 @@ static void Vox_SetVoxel(VoxArray3D* pvoxarray, int x, int y, int z, unsigned ch
 	chunk->m_array[offset] = id;
 }
 
+#if defined(VOX_LOADER_SIMPLE_MESHING)
 // Get voxel ID from its position into VoxArray3D
 static unsigned char Vox_GetVoxel(VoxArray3D* pvoxarray, int x, int y, int z)
 {
@@ -543,6 +553,253 @@ static void Vox_Build_Voxel(VoxArray3D* pvoxArray, int x, int y, int z, int matI
 	}
 }
 
+#endif // VOX_LOADER_SIMPLE_MESHING
+
+#if !defined(VOX_LOADER_SIMPLE_MESHING)
+// Quad produced by greedy meshing, position relative to its chunk
+typedef struct {
+	unsigned char x, y, z;      // Min voxel of the quad
+	unsigned char w, h;         // Extent in voxels along the face plane axes (u, v)
+	unsigned char face;         // Face orientation, index into fv[]
+	unsigned char matID;        // Palette index
+	unsigned char padding;
+} VoxQuad;
+
+typedef struct {
+	VoxQuad* array;
+	int used, size;
+} ArrayVoxQuad;
+
+static void insertArrayVoxQuad(ArrayVoxQuad* a, VoxQuad element)
+{
+	if (a->used == a->size)
+	{
+		a->size = (a->size == 0)? 64 : a->size * 2;
+		a->array = (VoxQuad *)VOX_REALLOC(a->array, a->size * sizeof(VoxQuad));
+	}
+	a->array[a->used++] = element;
+}
+
+// Get index of lowest set bit, bits must not be 0
+static int Vox_LowestBit(unsigned int bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctz(bits);
+#else
+	int n = 0;
+	while ((bits & 1) == 0) { bits >>= 1; n++; }
+	return n;
+#endif
+}
+
+// Get voxel index into a chunk m_array from a face plane position
+// Plane axes per face axis: X -> (u = y, v = z), Y -> (u = x, v = z), Z -> (u = x, v = y)
+static int Vox_PlaneChunkIndex(int axis, int slice, int u, int v)
+{
+	if (axis == 0) return (slice << CHUNK_FLATTENOFFSET_OPSHIFT) + (v << CHUNKSIZE_OPSHIFT) + u;
+	else if (axis == 1) return (u << CHUNK_FLATTENOFFSET_OPSHIFT) + (v << CHUNKSIZE_OPSHIFT) + slice;
+	return (u << CHUNK_FLATTENOFFSET_OPSHIFT) + (slice << CHUNKSIZE_OPSHIFT) + v;
+}
+
+// Get chunk voxels from its chunk position, NULL if out of array or empty
+static const unsigned char* Vox_GetChunkArray(VoxArray3D* pvoxarray, int chX, int chY, int chZ)
+{
+	if (chX < 0 || chY < 0 || chZ < 0) return NULL;
+	if (chX >= pvoxarray->chunksSizeX || chY >= pvoxarray->chunksSizeY || chZ >= pvoxarray->chunksSizeZ) return NULL;
+
+	return pvoxarray->m_arrayChunks[(chX * pvoxarray->ChunkFlattenOffset) + (chZ * pvoxarray->chunksSizeY) + chY].m_array;
+}
+
+// Build greedy meshed quads for a chunk
+// Visible faces are found with per column occupancy bitmasks, then faces of the same
+// material are merged into rectangles, one CHUNKSIZE*CHUNKSIZE slice at a time
+static void Vox_Build_ChunkQuads(VoxArray3D* pvoxarray, int chunkIndex, ArrayVoxQuad* quads)
+{
+	const unsigned char* ids = pvoxarray->m_arrayChunks[chunkIndex].m_array;
+	if (ids == 0) return;
+
+	// Chunk position, from flatten offset: (chX * ChunkFlattenOffset) + (chZ * chunksSizeY) + chY
+	int chX = chunkIndex / pvoxarray->ChunkFlattenOffset;
+	int chZ = (chunkIndex % pvoxarray->ChunkFlattenOffset) / pvoxarray->chunksSizeY;
+	int chY = chunkIndex % pvoxarray->chunksSizeY;
+
+	// Occupancy columns along each axis, [axis][v][u]
+	// Bit n + 1 is voxel n of the column, bits 0 and CHUNKSIZE + 1 are the neighbour chunks voxels
+	unsigned int cols[3][CHUNKSIZE][CHUNKSIZE];
+	memset(cols, 0, sizeof(cols));
+
+	int x, y, z, u, v;
+	for (x = 0; x < CHUNKSIZE; x++)
+	{
+		for (z = 0; z < CHUNKSIZE; z++)
+		{
+			const unsigned char* column = &ids[(x << CHUNK_FLATTENOFFSET_OPSHIFT) + (z << CHUNKSIZE_OPSHIFT)];
+
+			for (y = 0; y < CHUNKSIZE; y++)
+			{
+				if (column[y] == 0) continue;
+
+				cols[0][z][y] |= (2u << x);
+				cols[1][z][x] |= (2u << y);
+				cols[2][y][x] |= (2u << z);
+			}
+		}
+	}
+
+	const unsigned char* neighbours[6] = {
+		Vox_GetChunkArray(pvoxarray, chX - 1, chY, chZ), Vox_GetChunkArray(pvoxarray, chX + 1, chY, chZ),
+		Vox_GetChunkArray(pvoxarray, chX, chY - 1, chZ), Vox_GetChunkArray(pvoxarray, chX, chY + 1, chZ),
+		Vox_GetChunkArray(pvoxarray, chX, chY, chZ - 1), Vox_GetChunkArray(pvoxarray, chX, chY, chZ + 1)
+	};
+
+	for (int face = 0; face < 6; face++)
+	{
+		if (neighbours[face] == NULL) continue;
+
+		int axis = face >> 1;
+		int slice = (face & 1)? 0 : CHUNKSIZE - 1;  // Neighbour layer touching this chunk
+		unsigned int bit = (face & 1)? (1u << (CHUNKSIZE + 1)) : 1u;
+
+		for (v = 0; v < CHUNKSIZE; v++)
+		{
+			for (u = 0; u < CHUNKSIZE; u++)
+			{
+				if (neighbours[face][Vox_PlaneChunkIndex(axis, slice, u, v)] != 0) cols[axis][v][u] |= bit;
+			}
+		}
+	}
+
+	for (int face = 0; face < 6; face++)
+	{
+		int axis = face >> 1;
+
+		// Visible faces: solid voxel with an empty neighbour on the face side,
+		// transposed into slices of rows, [slice][v], bit n = u
+		unsigned short planes[CHUNKSIZE][CHUNKSIZE];
+		memset(planes, 0, sizeof(planes));
+		unsigned int slices = 0;
+
+		for (v = 0; v < CHUNKSIZE; v++)
+		{
+			for (u = 0; u < CHUNKSIZE; u++)
+			{
+				unsigned int col = cols[axis][v][u];
+				unsigned int faces = (face & 1)? (col & ~(col >> 1)) : (col & ~(col << 1));
+				faces = (faces >> 1) & 0xffff;
+				slices |= faces;
+
+				while (faces != 0)
+				{
+					planes[Vox_LowestBit(faces)][v] |= (unsigned short)(1u << u);
+					faces &= faces - 1;
+				}
+			}
+		}
+
+		// Greedy merge faces of each slice into rectangles of the same material
+		while (slices != 0)
+		{
+			int slice = Vox_LowestBit(slices);
+			slices &= slices - 1;
+
+			unsigned short* rows = planes[slice];
+
+			for (v = 0; v < CHUNKSIZE; v++)
+			{
+				while (rows[v] != 0)
+				{
+					u = Vox_LowestBit(rows[v]);
+					unsigned char matID = ids[Vox_PlaneChunkIndex(axis, slice, u, v)];
+
+					int w = 1;
+					while ((u + w < CHUNKSIZE) && (rows[v] & (1u << (u + w))) &&
+						(ids[Vox_PlaneChunkIndex(axis, slice, u + w, v)] == matID)) w++;
+
+					unsigned short runMask = (unsigned short)(((1u << w) - 1) << u);
+					rows[v] &= ~runMask;
+
+					int h = 1;
+					while ((v + h < CHUNKSIZE) && ((rows[v + h] & runMask) == runMask))
+					{
+						int k = 0;
+						while ((k < w) && (ids[Vox_PlaneChunkIndex(axis, slice, u + k, v + h)] == matID)) k++;
+						if (k < w) break;
+
+						rows[v + h] &= ~runMask;
+						h++;
+					}
+
+					VoxQuad quad = { 0 };
+					if (axis == 0) { quad.x = slice; quad.y = u; quad.z = v; }
+					else if (axis == 1) { quad.x = u; quad.y = slice; quad.z = v; }
+					else { quad.x = u; quad.y = v; quad.z = slice; }
+					quad.w = w;
+					quad.h = h;
+					quad.face = face;
+					quad.matID = matID;
+
+					insertArrayVoxQuad(quads, quad);
+				}
+			}
+		}
+	}
+}
+
+// Build vertices/normals/colors/indices from a chunk quads
+static void Vox_Build_QuadVertices(VoxArray3D* pvoxarray, int chunkIndex, const ArrayVoxQuad* quads)
+{
+	int ox = (chunkIndex / pvoxarray->ChunkFlattenOffset) << CHUNKSIZE_OPSHIFT;
+	int oz = ((chunkIndex % pvoxarray->ChunkFlattenOffset) / pvoxarray->chunksSizeY) << CHUNKSIZE_OPSHIFT;
+	int oy = (chunkIndex % pvoxarray->chunksSizeY) << CHUNKSIZE_OPSHIFT;
+	float scale = 0.25;
+
+	for (int i = 0; i < quads->used; i++)
+	{
+		const VoxQuad* quad = &quads->array[i];
+		int axis = quad->face >> 1;
+
+		// Unit cube corners stretched along the plane axes
+		VoxVector3 size = { 1, 1, 1 };
+		if (axis == 0) { size.y = quad->w; size.z = quad->h; }
+		else if (axis == 1) { size.x = quad->w; size.z = quad->h; }
+		else { size.x = quad->w; size.y = quad->h; }
+
+		// Arrays are sized for all quads, write them directly
+		int idx = pvoxarray->vertices.used;
+		VoxVector3* vertices = &pvoxarray->vertices.array[idx];
+		VoxVector3* normals = &pvoxarray->normals.array[idx];
+		VoxColor* colors = &pvoxarray->colors.array[idx];
+		unsigned short* indices = &pvoxarray->indices.array[pvoxarray->indices.used];
+		VoxColor col = pvoxarray->palette[quad->matID];
+
+		for (int j = 0; j < 4; j++)
+		{
+			VoxVector3 vtx = SolidVertex[fv[quad->face][j]];
+			vertices[j].x = (ox + quad->x + vtx.x * size.x) * scale;
+			vertices[j].y = (oy + quad->y + vtx.y * size.y) * scale;
+			vertices[j].z = (oz + quad->z + vtx.z * size.z) * scale;
+
+			normals[j] = FacesPerSideNormal[quad->face];
+			colors[j] = col;
+		}
+
+		//v0 - v1 - v2, v0 - v2 - v3
+		indices[0] = (unsigned short)(idx + 0);
+		indices[1] = (unsigned short)(idx + 2);
+		indices[2] = (unsigned short)(idx + 1);
+
+		indices[3] = (unsigned short)(idx + 0);
+		indices[4] = (unsigned short)(idx + 3);
+		indices[5] = (unsigned short)(idx + 2);
+
+		pvoxarray->vertices.used += 4;
+		pvoxarray->normals.used += 4;
+		pvoxarray->colors.used += 4;
+		pvoxarray->indices.used += 6;
+	}
+}
+#endif // !VOX_LOADER_SIMPLE_MESHING
+
 // MagicaVoxel *.vox file format Loader
 int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray)
 {
@@ -667,6 +924,7 @@ int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArr
 	// Building Mesh
 	//   TODO compute globals indices array
 
+#if defined(VOX_LOADER_SIMPLE_MESHING)
 	// Init Arrays
 	initArrayVector3(&pvoxarray->vertices, 3 * 1024);
 	initArrayVector3(&pvoxarray->normals, 3 * 1024);
@@ -688,6 +946,37 @@ int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArr
 			}
 		}
 	}
+#else
+	// Mesh every chunk independently into quads, chunks only read the voxel array
+	ArrayVoxQuad* chunkQuads = (ArrayVoxQuad *)VOX_CALLOC(pvoxarray->chunksTotal, sizeof(ArrayVoxQuad));
+	int chunkIndex;
+
+#if defined(_OPENMP)
+	#pragma omp parallel for schedule(dynamic, 1)
+#endif
+	for (chunkIndex = 0; chunkIndex < pvoxarray->chunksTotal; chunkIndex++)
+	{
+		Vox_Build_ChunkQuads(pvoxarray, chunkIndex, &chunkQuads[chunkIndex]);
+	}
+
+	// Expand quads into the mesh arrays, sized up front
+	int quadCount = 0;
+	for (chunkIndex = 0; chunkIndex < pvoxarray->chunksTotal; chunkIndex++) quadCount += chunkQuads[chunkIndex].used;
+
+	int vertexCount = (quadCount > 0)? quadCount * 4 : 4;
+	initArrayVector3(&pvoxarray->vertices, vertexCount);
+	initArrayVector3(&pvoxarray->normals, vertexCount);
+	initArrayUShort(&pvoxarray->indices, vertexCount / 4 * 6);
+	initArrayColor(&pvoxarray->colors, vertexCount);
+
+	for (chunkIndex = 0; chunkIndex < pvoxarray->chunksTotal; chunkIndex++)
+	{
+		if (chunkQuads[chunkIndex].used > 0) Vox_Build_QuadVertices(pvoxarray, chunkIndex, &chunkQuads[chunkIndex]);
+		VOX_FREE(chunkQuads[chunkIndex].array);
+	}
+
+	VOX_FREE(chunkQuads);
+#endif
 
 	return VOX_SUCCESS;
 }
@@ -721,6 +1010,7 @@ void Vox_FreeArrays(VoxArray3D* voxarray)
 	// Free arrays
 	freeArrayVector3(&voxarray->vertices);
 	freeArrayUShort(&voxarray->indices);
+	freeArrayVector3(&voxarray->normals);
 	freeArrayColor(&voxarray->colors);
 }
 
@@ -543,6 +543,14 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Hash state, used for incremental hash computation
+typedef struct HashState {
+    int type;                       // Hash type (HashType)
+    unsigned int value[8];          // Hash intermediate values
+    unsigned char block[64];        // Pending input data, not processed yet
+    unsigned long long size;        // Total input data size (bytes)
+} HashState;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -960,6 +968,14 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Hash types
+typedef enum {
+    HASH_CRC32 = 0,                 // CRC32 (4 bytes)
+    HASH_MD5,                       // MD5 (16 bytes)
+    HASH_SHA1,                      // SHA-1 (20 bytes)
+    HASH_SHA256                     // SHA-256 (32 bytes)
+} HashType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1067,6 +1083,7 @@ RLAPI void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR s
 // NOTE: Shader functionality is not available on OpenGL 1.1
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
 RLAPI Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
+RLAPI bool ReloadShader(Shader *shader, const char *vsFileName, const char *fsFileName); // Reload shader from files, keeps shader id (custom locations must be queried again)
 RLAPI bool IsShaderValid(Shader shader);                                   // Check if a shader is valid (loaded on GPU)
 RLAPI int GetShaderLocation(Shader shader, const char *uniformName);       // Get shader uniform location
 RLAPI int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
@@ -1166,18 +1183,28 @@ RLAPI void UnloadDirectoryFiles(FilePathList files);                // Unload fi
 RLAPI bool IsFileDropped(void);                                     // Check if a file has been dropped into window
 RLAPI FilePathList LoadDroppedFiles(void);                          // Load dropped filepaths
 RLAPI void UnloadDroppedFiles(FilePathList files);                  // Unload dropped filepaths
+RLAPI bool WatchFile(const char *fileName);                         // Watch file for changes (inotify on Linux, polling otherwise), returns true on success
+RLAPI void UnwatchFile(const char *fileName);                       // Stop watching file for changes
+RLAPI bool IsFileChanged(void);                                     // Check if any watched file has changed (updated once per frame)
+RLAPI FilePathList LoadChangedFiles(void);                          // Load changed watched filepaths
+RLAPI void UnloadChangedFiles(FilePathList files);                  // Unload changed filepaths
 RLAPI unsigned int GetDirectoryFileCount(const char *dirPath);      // Get the file count in a directory
 RLAPI unsigned int GetDirectoryFileCountEx(const char *basePath, const char *filter, bool scanSubdirs); // Get the file count in a directory with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
 
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI int DecompressDataToBuffer(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity); // Decompress data (DEFLATE algorithm) into provided buffer, returns size or -1 on failure
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string (includes NULL terminator), memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const char *text, int *outputSize);                             // Decode Base64 string (expected NULL terminated), memory must be MemFree()
+RLAPI int DecodeDataBase64ToBuffer(const char *text, int textSize, unsigned char *data, int dataCapacity); // Decode Base64 text into provided buffer, returns decoded size or -1 on error
 RLAPI unsigned int ComputeCRC32(unsigned char *data, int dataSize);       // Compute CRC32 hash code
 RLAPI unsigned int *ComputeMD5(unsigned char *data, int dataSize);        // Compute MD5 hash code, returns static int[4] (16 bytes)
 RLAPI unsigned int *ComputeSHA1(unsigned char *data, int dataSize);       // Compute SHA1 hash code, returns static int[5] (20 bytes)
 RLAPI unsigned int *ComputeSHA256(unsigned char *data, int dataSize);     // Compute SHA256 hash code, returns static int[8] (32 bytes)
+RLAPI HashState InitHashState(int type);                                  // Init hash state for incremental hash computation (HashType)
+RLAPI void UpdateHashState(HashState *state, const unsigned char *data, int dataSize); // Update hash state with a new chunk of data
+RLAPI void FinishHashState(HashState *state, unsigned int *hash);         // Finish hash computation, hash words written to provided array (1, 4, 5 or 8 ints)
 
 // Automation events functionality
 RLAPI AutomationEventList LoadAutomationEventList(const char *fileName); // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
@@ -1439,6 +1466,7 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI bool ReloadTexture(Texture2D *texture, const char *fileName);                                      // Reload texture from file, keeps texture id if size and format match
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureValid(Texture2D texture);                                                            // Check if a texture is valid (loaded in GPU)
@@ -1586,6 +1614,7 @@ RLAPI void DrawGrid(int slices, float spacing);
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
+RLAPI bool ReloadModel(Model *model, const char *fileName);                                 // Reload model from file, keeps meshes buffers and materials if layout matches
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
@@ -146,6 +146,37 @@
     #include "external/rprand.h"
 #endif
 
+// Hardware accelerated hashing and Base64 paths, enabled when target architecture flags allow it
+// NOTE: x86 requires -msse4.1 -mpclmul -msha -mavx2 (or -march=native), ARM requires -march=armv8-a+crc+crypto
+#if defined(__SSE4_1__) && defined(__PCLMUL__)
+    #define RL_CRC32_PCLMUL
+#endif
+#if defined(__SSE4_1__) && defined(__SHA__)
+    #define RL_SHA_X86
+#endif
+#if defined(__SSSE3__)
+    #define RL_BASE64_SSSE3
+#endif
+#if defined(__AVX2__)
+    #define RL_BASE64_AVX2
+#endif
+#if defined(RL_CRC32_PCLMUL) || defined(RL_SHA_X86) || defined(RL_BASE64_SSSE3) || defined(RL_BASE64_AVX2)
+    #include <immintrin.h>          // Required for: PCLMULQDQ, SHA-NI and SSSE3/AVX2 intrinsics [Used in UpdateCRC32(), ProcessSHA1Blocks(), ProcessSHA256Blocks(), EncodeBase64Blocks(), DecodeBase64Blocks()]
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+    #define RL_CRC32_ARM
+    #include <arm_acle.h>           // Required for: __crc32d() [Used in UpdateCRC32()]
+#endif
+#if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+    #define RL_SHA_ARM
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #define RL_BASE64_NEON
+#endif
+#if defined(RL_SHA_ARM) || defined(RL_BASE64_NEON)
+    #include <arm_neon.h>           // Required for: SHA1/SHA256 crypto extension and NEON intrinsics [Used in ProcessSHA1Blocks(), ProcessSHA256Blocks(), EncodeBase64Blocks(), DecodeBase64Blocks()]
+#endif
+
 #if defined(__linux__) && !defined(_GNU_SOURCE)
     #define _GNU_SOURCE
 #endif
@@ -210,6 +241,11 @@
     #define ACCESS(fn) access(fn, F_OK)
 #endif
 
+#if SUPPORT_FILE_WATCHER && defined(__linux__)
+    #include <sys/inotify.h>        // Required for: inotify_init1(), inotify_add_watch(), inotify_rm_watch() [Used in WatchFile()]
+    #define FILE_WATCHER_INOTIFY
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -260,13 +296,20 @@
 #endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
-    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
+    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size DecompressData() buffer can grow up to in MB
 #endif
 
 #ifndef MAX_AUTOMATION_EVENTS
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef FILE_WATCHER_COALESCE_TIME
+    #define FILE_WATCHER_COALESCE_TIME  0.05        // Time (seconds) a watched file must stay unmodified to be reported as changed
+#endif
+#ifndef FILE_WATCHER_POLL_COUNT
+    #define FILE_WATCHER_POLL_COUNT      256        // Maximum number of watched files checked per frame, when polling
+#endif
+
 #ifndef FILE_FILTER_TAG_ALL
     #define FILE_FILTER_TAG_ALL        "*.*"        // Filter to include all file types and directories on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), LoadDirectoryFilesEx() and GetDirectoryFileCountEx()
@@ -388,6 +431,47 @@ typedef struct CoreData {
     } Time;
 } CoreData;
 
+#if SUPPORT_FILE_WATCHER
+// Watched file data
+typedef struct WatchedFile {
+    char *path;                         // File path, as provided to WatchFile()
+    unsigned int hash;                  // File path hash
+    int dirIndex;                       // Watched directory index
+    long modTime;                       // Last known modification time (polling)
+    long size;                          // Last known file size (polling)
+    double eventTime;                   // Last change event time, 0.0 if no change pending
+    bool changed;                       // File is already in changed files list
+} WatchedFile;
+
+// Watched directory data
+// NOTE: Directories are watched instead of files, so files replaced
+// on save (written to a temp file and renamed) are also detected
+typedef struct WatchedDirectory {
+    char *path;                         // Directory path, including trailing separator ("" for working directory)
+    int wd;                             // Watch descriptor (inotify), -1 if directory files must be polled
+    int fileCount;                      // Number of watched files in directory
+} WatchedDirectory;
+
+// File watcher state
+typedef struct FileWatcher {
+    bool ready;                         // File watcher initialized
+    int fd;                             // File descriptor (inotify), -1 if not available
+    WatchedFile *files;                 // Watched files
+    int fileCount;                      // Watched files count
+    int fileCapacity;                   // Watched files capacity
+    WatchedDirectory *dirs;             // Watched directories
+    int dirCount;                       // Watched directories count
+    int polledCount;                    // Watched files count requiring polling
+    int pollIndex;                      // Next watched file to check when polling
+    int *table;                         // Files hash table (open addressing), stores file index + 1, 0 for empty slots
+    int tableSize;                      // Files hash table size (power of two)
+    int *pending;                       // Watched files indices with changes pending to be reported
+    int pendingCount;                   // Pending files count
+    FilePathList changed;               // Changed files paths, reported by LoadChangedFiles()
+    unsigned int changedCapacity;       // Changed files paths capacity
+} FileWatcher;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -407,6 +491,36 @@ static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback fun
 static int screenshotCounter = 0;                   // Screenshots counter
 #endif
 
+#if SUPPORT_FILE_WATCHER
+static FileWatcher watcher = { 0 };                 // File watcher state
+#endif
+
+// Base64 conversion table from RFC 4648 [0..63]
+// NOTE: They represent 64 values (6 bits), to encode 3 bytes of data into 4 "sixtets" (6bit characters)
+static const char base64EncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Base64 decode table
+// NOTE: Following ASCII order [0..255] assigning the expected sixtet value to
+// every character in the corresponding ASCII position, invalid characters are set to 0xff
+static const unsigned char base64DecodeTable[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
 #if SUPPORT_AUTOMATION_EVENTS
 // Automation events type
 typedef enum AutomationEventType {
@@ -503,6 +617,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if SUPPORT_MODULE_RMODELS
+extern void UnloadMeshGenCache(void);   // [Module: models] Unloads generated meshes cache
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -512,10 +629,26 @@ static void SetupViewport(int width, int height);           // Set viewport for
 
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter, unsigned int expectedFileCount, bool scanSubdirs); // Scan all files and directories in a base path
 
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize); // Update CRC32 state with provided data
+static void ProcessHashBlocks(HashState *state, const unsigned char *data, int blockCount); // Process full 64-byte blocks for block-based hash types
+static int EncodeBase64Blocks(const unsigned char *data, int dataSize, char *output); // Encode full 3 byte groups to Base64 using SIMD kernels (if available)
+static int DecodeBase64Blocks(const char *text, int textSize, unsigned char *output, int outputCapacity); // Decode full 4 sixtet groups from Base64 using SIMD kernels (if available)
+
 #if SUPPORT_AUTOMATION_EVENTS
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if SUPPORT_FILE_WATCHER
+static unsigned int ComputeFileWatcherHash(const char *path, int length); // Compute file path hash (FNV-1a), length -1 for NULL terminated paths
+static int FindWatchedFile(const char *path, unsigned int hash); // Find watched file index by path, -1 if not found
+static void BuildFileWatcherTable(void);                // Build watched files hash table, required after files array changes
+static void SetWatchedFileChanged(int index, double time); // Register change event for a watched file, pending to be reported
+static void UpdateFileWatcher(void);                    // Update file watcher: read change events, poll files and report coalesced changes
+static void CloseFileWatcher(void);                     // Close file watcher and free all watched files data
+#endif
+
+static void SetShaderLocationsDefault(Shader *shader);  // Set shader default locations (attributes and uniforms), shader.locs must be allocated
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: Declaring Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 __declspec(dllimport) void __stdcall Sleep(unsigned long msTimeout); // Required for: WaitTime()
@@ -735,8 +868,16 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if SUPPORT_MODULE_RMODELS
+    UnloadMeshGenCache();       // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+#if SUPPORT_FILE_WATCHER
+    CloseFileWatcher();
+#endif
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -914,6 +1055,10 @@ void EndDrawing(void)
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
+#if SUPPORT_FILE_WATCHER
+    if (watcher.fileCount > 0) UpdateFileWatcher();     // Update changed files (before next frame update)
+#endif
+
 #if SUPPORT_SCREEN_CAPTURE
     if (IsKeyPressed(KEY_F12))
     {
@@ -1255,53 +1400,51 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
     else if (shader.id == rlGetShaderIdDefault()) shader.locs = rlGetShaderLocsDefault();
     else if (shader.id > 0)
     {
-        // After custom shader loading, trying to set default location names
-        // Default shader attribute locations have been binded before linking:
-        //  - vertex position location    = 0
-        //  - vertex texcoord location    = 1
-        //  - vertex normal location      = 2
-        //  - vertex color location       = 3
-        //  - vertex tangent location     = 4
-        //  - vertex texcoord2 location   = 5
-        //  - vertex boneIndices location = 6
-        //  - vertex boneWeights location = 7
-
-        // NOTE: If any location is not found, loc point becomes -1
-
         // Load shader locations array
         // NOTE: All locations set to -1 (no location)
         shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
-        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
-        // Get handles to GLSL input attribute locations
-        shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-        shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-        shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-        shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-        shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEINDICES);
-        shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
-        shader.locs[SHADER_LOC_VERTEX_INSTANCETRANSFORM] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM);
-
-        // Get handles to GLSL uniform locations (vertex shader)
-        shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
-        shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
-        shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
-        shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
-        shader.locs[SHADER_LOC_MATRIX_BONETRANSFORMS] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONEMATRICES);
-
-        // Get handles to GLSL uniform locations (fragment shader)
-        shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
-        shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
-        shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+        SetShaderLocationsDefault(&shader);
     }
 
     return shader;
 }
 
+// Reload shader from files, keeping shader id and locations array
+// NOTE: Default locations are refreshed, custom locations must be queried again,
+// on failure (files not valid, compilation or linkage errors) previous shader is kept
+bool ReloadShader(Shader *shader, const char *vsFileName, const char *fsFileName)
+{
+    bool result = false;
+
+    if ((shader == NULL) || (shader->locs == NULL) || (shader->id == 0) || (shader->id == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Shader provided is not valid for reloading");
+        return result;
+    }
+
+    char *vShaderStr = NULL;
+    char *fShaderStr = NULL;
+
+    if (vsFileName != NULL) vShaderStr = LoadFileText(vsFileName);
+    if (fsFileName != NULL) fShaderStr = LoadFileText(fsFileName);
+
+    if (((vsFileName != NULL) && (vShaderStr == NULL)) || ((fsFileName != NULL) && (fShaderStr == NULL)))
+    {
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Shader files provided are not valid, shader not reloaded", shader->id);
+    }
+    else if (rlReloadShaderCode(shader->id, vShaderStr, fShaderStr))
+    {
+        SetShaderLocationsDefault(shader);
+        result = true;
+    }
+
+    UnloadFileText(vShaderStr);
+    UnloadFileText(fShaderStr);
+
+    return result;
+}
+
 // Check if a shader is valid (loaded on GPU)
 bool IsShaderValid(Shader shader)
 {
@@ -2912,6 +3055,217 @@ void UnloadDroppedFiles(FilePathList files)
     }
 }
 
+// Watch file for changes, changed files are reported once per frame by LoadChangedFiles()
+// NOTE: On Linux file containing directory is watched with inotify, files modification
+// time is polled on other platforms (or if inotify is not available), up to FILE_WATCHER_POLL_COUNT files per frame
+bool WatchFile(const char *fileName)
+{
+    bool result = false;
+
+#if SUPPORT_FILE_WATCHER
+    if ((fileName == NULL) || (fileName[0] == '\0')) return result;
+
+    if (!watcher.ready)
+    {
+        watcher.fd = -1;
+    #if defined(FILE_WATCHER_INOTIFY)
+        watcher.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (watcher.fd < 0) TRACELOG(LOG_WARNING, "FILEIO: Failed to initialize inotify, watched files will be polled");
+    #endif
+        watcher.ready = true;
+    }
+
+    unsigned int hash = ComputeFileWatcherHash(fileName, -1);
+    if (FindWatchedFile(fileName, hash) >= 0) return true;
+
+    struct stat info = { 0 };
+    if (stat(fileName, &info) != 0)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] File to watch does not exist", fileName);
+        return result;
+    }
+
+    // Get containing directory, path prefix is kept as provided (including separator)
+    // to compose watched file path from directory path and event file name
+    const char *separator = strrchr(fileName, '/');
+    #if defined(_WIN32)
+    const char *backslash = strrchr(fileName, '\\');
+    if ((separator == NULL) || ((backslash != NULL) && (backslash > separator))) separator = backslash;
+    #endif
+    int dirPathLength = (separator != NULL)? (int)(separator - fileName) + 1 : 0;
+
+    int dirIndex = -1;
+    for (int i = 0; i < watcher.dirCount; i++)
+    {
+        if (((int)strlen(watcher.dirs[i].path) == dirPathLength) && (strncmp(watcher.dirs[i].path, fileName, dirPathLength) == 0)) { dirIndex = i; break; }
+    }
+
+    if (dirIndex == -1)
+    {
+        // NOTE: Directories are never removed, only their watch
+        WatchedDirectory *dirs = (WatchedDirectory *)RL_REALLOC(watcher.dirs, (watcher.dirCount + 1)*sizeof(WatchedDirectory));
+        if (dirs == NULL) return result;
+
+        watcher.dirs = dirs;
+        dirIndex = watcher.dirCount;
+        watcher.dirs[dirIndex].path = (char *)RL_CALLOC(dirPathLength + 1, 1);
+        memcpy(watcher.dirs[dirIndex].path, fileName, dirPathLength);
+        watcher.dirs[dirIndex].wd = -1;
+        watcher.dirs[dirIndex].fileCount = 0;
+        watcher.dirCount++;
+    }
+
+    WatchedDirectory *dir = &watcher.dirs[dirIndex];
+
+    #if defined(FILE_WATCHER_INOTIFY)
+    if ((dir->fileCount == 0) && (watcher.fd >= 0))
+    {
+        dir->wd = inotify_add_watch(watcher.fd, (dirPathLength > 0)? dir->path : ".", IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE);
+        if (dir->wd < 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch directory, files will be polled", dir->path);
+    }
+    #endif
+
+    if (watcher.fileCount == watcher.fileCapacity)
+    {
+        int capacity = (watcher.fileCapacity > 0)? watcher.fileCapacity*2 : 64;
+        WatchedFile *files = (WatchedFile *)RL_REALLOC(watcher.files, capacity*sizeof(WatchedFile));
+        int *pending = (int *)RL_REALLOC(watcher.pending, capacity*sizeof(int));
+
+        if (files != NULL) watcher.files = files;
+        if (pending != NULL) watcher.pending = pending;
+        if ((files == NULL) || (pending == NULL)) return result;
+
+        watcher.fileCapacity = capacity;
+    }
+
+    WatchedFile *file = &watcher.files[watcher.fileCount];
+    memset(file, 0, sizeof(WatchedFile));
+    file->path = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(file->path, fileName);
+    file->hash = hash;
+    file->dirIndex = dirIndex;
+    file->modTime = (long)info.st_mtime;
+    file->size = (long)info.st_size;
+
+    dir->fileCount++;
+    if (dir->wd < 0) watcher.polledCount++;
+    watcher.fileCount++;
+
+    // Keep hash table load factor under 0.5
+    if (watcher.fileCount*2 > watcher.tableSize) BuildFileWatcherTable();
+    else
+    {
+        unsigned int mask = watcher.tableSize - 1;
+        unsigned int slot = hash & mask;
+        while (watcher.table[slot] != 0) slot = (slot + 1) & mask;
+        watcher.table[slot] = watcher.fileCount;
+    }
+
+    result = true;
+#endif
+
+    return result;
+}
+
+// Stop watching file for changes
+void UnwatchFile(const char *fileName)
+{
+#if SUPPORT_FILE_WATCHER
+    if ((fileName == NULL) || (watcher.fileCount == 0)) return;
+
+    int index = FindWatchedFile(fileName, ComputeFileWatcherHash(fileName, -1));
+    if (index < 0) return;
+
+    WatchedDirectory *dir = &watcher.dirs[watcher.files[index].dirIndex];
+    if (dir->wd < 0) watcher.polledCount--;
+    dir->fileCount--;
+
+    #if defined(FILE_WATCHER_INOTIFY)
+    if ((dir->fileCount == 0) && (dir->wd >= 0))
+    {
+        // NOTE: Same directory could be watched with a different path, sharing the watch descriptor
+        bool shared = false;
+        for (int i = 0; i < watcher.dirCount; i++)
+        {
+            if ((&watcher.dirs[i] != dir) && (watcher.dirs[i].wd == dir->wd) && (watcher.dirs[i].fileCount > 0)) { shared = true; break; }
+        }
+
+        if (!shared) inotify_rm_watch(watcher.fd, dir->wd);
+        dir->wd = -1;
+    }
+    #endif
+
+    RL_FREE(watcher.files[index].path);
+
+    // Move last file into removed file position, updating pending files indices
+    int last = watcher.fileCount - 1;
+    watcher.files[index] = watcher.files[last];
+    watcher.fileCount--;
+
+    for (int i = 0; i < watcher.pendingCount; i++)
+    {
+        if (watcher.pending[i] == index) watcher.pending[i--] = watcher.pending[--watcher.pendingCount];
+        else if (watcher.pending[i] == last) watcher.pending[i] = index;
+    }
+
+    if (watcher.pollIndex >= watcher.fileCount) watcher.pollIndex = 0;
+
+    BuildFileWatcherTable();
+#endif
+}
+
+// Check if any watched file has changed
+// NOTE: Changes are reported after FILE_WATCHER_COALESCE_TIME without new modifications,
+// changed files list is updated once per frame on EndDrawing()
+bool IsFileChanged(void)
+{
+    bool result = false;
+
+#if SUPPORT_FILE_WATCHER
+    if (watcher.changed.count > 0) result = true;
+#endif
+
+    return result;
+}
+
+// Load changed watched filepaths
+// NOTE: Changed files are accumulated until UnloadChangedFiles() is called
+FilePathList LoadChangedFiles(void)
+{
+    FilePathList files = { 0 };
+
+#if SUPPORT_FILE_WATCHER
+    files = watcher.changed;
+#endif
+
+    return files;
+}
+
+// Unload changed filepaths
+void UnloadChangedFiles(FilePathList files)
+{
+    // WARNING: files pointers are the same as internal ones
+
+#if SUPPORT_FILE_WATCHER
+    if (files.count > 0)
+    {
+        for (unsigned int i = 0; i < files.count; i++)
+        {
+            int index = FindWatchedFile(files.paths[i], ComputeFileWatcherHash(files.paths[i], -1));
+            if (index >= 0) watcher.files[index].changed = false;
+
+            RL_FREE(files.paths[i]);
+        }
+
+        RL_FREE(files.paths);
+
+        watcher.changed.count = 0;
+        watcher.changed.paths = NULL;
+        watcher.changedCapacity = 0;
+    }
+#endif
+}
+
 // Get the file count in a directory
 unsigned int GetDirectoryFileCount(const char *dirPath)
 {
@@ -2996,74 +3350,108 @@ unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDa
 unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
+    *dataSize = 0;
 
 #if SUPPORT_COMPRESSION_API
-    // Decompress data from a valid DEFLATE stream
-    unsigned char *data0 = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int size = sinflate(data0, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    // Decompress data from a valid DEFLATE stream into a growable buffer,
+    // initial capacity is estimated from compressed size (typical ratio is below 1:4)
+    const int maxSize = MAX_DECOMPRESSION_SIZE*1024*1024;
+    int capacity = (compDataSize < maxSize/4)? compDataSize*4 : maxSize;
+    if (capacity < 4096) capacity = (maxSize < 4096)? maxSize : 4096;
+
+    struct sinfl_stream stream = { 0 };
+    sinfl_stream_init(&stream, compData, compDataSize);
+    data = (unsigned char *)RL_MALLOC(capacity);
+
+    int result = sinfl_stream_inflate(&stream, data, capacity);
+    while ((result == SINFL_STREAM_FULL) && (capacity < maxSize))
+    {
+        int newCapacity = (capacity < maxSize/2)? capacity*2 : maxSize;
+
+        // WARNING: RL_REALLOC can make (and leave) data copies in memory,
+        // that can be a security concern in case of compression of sensitive data
+        // So, using a second buffer to copy data manually, wiping only the written bytes
+        unsigned char *newData = (unsigned char *)RL_MALLOC(newCapacity);
+        memcpy(newData, data, stream.total);
+        memset(data, 0, stream.total);
+        RL_FREE(data);
+
+        data = newData;
+        capacity = newCapacity;
+        result = sinfl_stream_inflate(&stream, data, capacity);
+    }
+
+    if (result != SINFL_STREAM_DONE)
+    {
+        if (result == SINFL_STREAM_FULL) TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Size exceeds MAX_DECOMPRESSION_SIZE (%i MB)", MAX_DECOMPRESSION_SIZE);
+        else TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Invalid or truncated DEFLATE stream");
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory,
-    // that can be a security concern in case of compression of sensitive data
-    // So, using a second buffer to copy data manually, wiping original buffer memory
-    data = (unsigned char *)RL_CALLOC(size, 1);
-    memcpy(data, data0, size);
-    memset(data0, 0, MAX_DECOMPRESSION_SIZE*1024*1024); // Wipe memory, is memset() safe?
-    RL_FREE(data0);
+        memset(data, 0, stream.total);
+        RL_FREE(data);
+        return NULL;
+    }
 
-    TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, size);
+    TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, stream.total);
 
-    *dataSize = size;
+    *dataSize = stream.total;
 #endif
 
     return data;
 }
 
+// Decompress data (DEFLATE algorithm) into a provided buffer
+// NOTE: Returns decompressed size, -1 if data does not fit in buffer or stream is not valid
+int DecompressDataToBuffer(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity)
+{
+    int dataSize = -1;
+
+#if SUPPORT_COMPRESSION_API
+    struct sinfl_stream stream = { 0 };
+    sinfl_stream_init(&stream, compData, compDataSize);
+
+    int result = sinfl_stream_inflate(&stream, data, dataCapacity);
+    if (result == SINFL_STREAM_DONE) dataSize = stream.total;
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: %s", (result == SINFL_STREAM_FULL)? "Provided buffer is too small" : "Invalid or truncated DEFLATE stream");
+        memset(data, 0, stream.total);
+    }
+#endif
+
+    return dataSize;
+}
+
 // Encode data to Base64 string
 // NOTE: Returned string includes NULL terminator, considered on outputSize
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
-    // Base64 conversion table from RFC 4648 [0..63]
-    // NOTE: They represent 64 values (6 bits), to encode 3 bytes of data into 4 "sixtets" (6bit characters)
-    static const char base64EncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-    // Compute expected size and padding
-    int paddedSize = dataSize;
-    while (paddedSize%3 != 0) paddedSize++; // Padding bytes to round 4*(dataSize/3) to 4 bytes
-    int estimatedOutputSize = 4*(paddedSize/3);
-    int padding = paddedSize - dataSize;
-
-    // Adding null terminator to string
-    estimatedOutputSize += 1;
+    // Compute expected size, 3 bytes of data are encoded into 4 "sixtets" (6bit characters)
+    // NOTE: Adding null terminator to string
+    int estimatedOutputSize = 4*((dataSize + 2)/3) + 1;
 
     // Load some memory to store encoded string
-    char *encodedData = (char *)RL_CALLOC(estimatedOutputSize, 1);
+    char *encodedData = (char *)RL_MALLOC(estimatedOutputSize);
     if (encodedData == NULL) return NULL;
 
-    int outputCount = 0;
-    for (int i = 0; i < dataSize;)
-    {
-        unsigned int octetA = 0;
-        unsigned int octetB = 0;
-        unsigned int octetC = 0;
-        unsigned int octetPack = 0;
+    // Encode full 3 byte groups with SIMD kernels (if available), remaining data with scalar path
+    int i = EncodeBase64Blocks(data, dataSize, encodedData);
+    int outputCount = 4*(i/3);
 
-        octetA = data[i]; // Generates 2 sextets
-        octetB = ((i + 1) < dataSize)? data[i + 1] : 0; // Generates 3 sextets
-        octetC = ((i + 2) < dataSize)? data[i + 2] : 0; // Generates 4 sextets
+    for (; i < dataSize; i += 3)
+    {
+        unsigned int octetA = data[i]; // Generates 2 sextets
+        unsigned int octetB = ((i + 1) < dataSize)? data[i + 1] : 0; // Generates 3 sextets
+        unsigned int octetC = ((i + 2) < dataSize)? data[i + 2] : 0; // Generates 4 sextets
 
-        octetPack = (octetA << 16) | (octetB << 8) | octetC;
+        unsigned int octetPack = (octetA << 16) | (octetB << 8) | octetC;
 
-        encodedData[outputCount + 0] = (unsigned char)(base64EncodeTable[(octetPack >> 18) & 0x3f]);
-        encodedData[outputCount + 1] = (unsigned char)(base64EncodeTable[(octetPack >> 12) & 0x3f]);
-        encodedData[outputCount + 2] = (unsigned char)(base64EncodeTable[(octetPack >> 6) & 0x3f]);
-        encodedData[outputCount + 3] = (unsigned char)(base64EncodeTable[octetPack & 0x3f]);
+        encodedData[outputCount + 0] = base64EncodeTable[(octetPack >> 18) & 0x3f];
+        encodedData[outputCount + 1] = base64EncodeTable[(octetPack >> 12) & 0x3f];
+        encodedData[outputCount + 2] = ((i + 1) < dataSize)? base64EncodeTable[(octetPack >> 6) & 0x3f] : '=';
+        encodedData[outputCount + 3] = ((i + 2) < dataSize)? base64EncodeTable[octetPack & 0x3f] : '=';
         outputCount += 4;
-        i += 3;
     }
 
-    // Add required padding bytes
-    for (int p = 0; p < padding; p++) encodedData[outputCount - p - 1] = '=';
-
     // Add null terminator to string
     encodedData[outputCount] = '\0';
     outputCount++;
@@ -3077,448 +3465,255 @@ char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 // Decode Base64 string (expected NULL terminated)
 unsigned char *DecodeDataBase64(const char *text, int *outputSize)
 {
-    // Base64 decode table
-    // NOTE: Following ASCII order [0..255] assigning the expected sixtet value to
-    // every character in the corresponding ASCII position
-    static const unsigned char base64DecodeTable[256] = {
-        ['A'] =  0, ['B'] =  1, ['C'] =  2, ['D'] =  3, ['E'] =  4, ['F'] =  5, ['G'] =  6, ['H'] =  7,
-        ['I'] =  8, ['J'] =  9, ['K'] = 10, ['L'] = 11, ['M'] = 12, ['N'] = 13, ['O'] = 14, ['P'] = 15,
-        ['Q'] = 16, ['R'] = 17, ['S'] = 18, ['T'] = 19, ['U'] = 20, ['V'] = 21, ['W'] = 22, ['X'] = 23, ['Y'] = 24, ['Z'] = 25,
-        ['a'] = 26, ['b'] = 27, ['c'] = 28, ['d'] = 29, ['e'] = 30, ['f'] = 31, ['g'] = 32, ['h'] = 33,
-        ['i'] = 34, ['j'] = 35, ['k'] = 36, ['l'] = 37, ['m'] = 38, ['n'] = 39, ['o'] = 40, ['p'] = 41,
-        ['q'] = 42, ['r'] = 43, ['s'] = 44, ['t'] = 45, ['u'] = 46, ['v'] = 47, ['w'] = 48, ['x'] = 49, ['y'] = 50, ['z'] = 51,
-        ['0'] = 52, ['1'] = 53, ['2'] = 54, ['3'] = 55, ['4'] = 56, ['5'] = 57, ['6'] = 58, ['7'] = 59,
-        ['8'] = 60, ['9'] = 61, ['+'] = 62, ['/'] = 63
-    };
-
     *outputSize = 0;
     if (text == NULL) return NULL;
 
-    // Compute expected size and padding
-    int dataSize = (int)strlen(text); // WARNING: Expecting NULL terminated strings!
-    int ending = dataSize - 1;
-    int padding = 0;
-    while (text[ending] == '=') { padding++; ending--; }
-    int estimatedOutputSize = 3*(dataSize/4) - padding;
-    int maxOutputSize = 3*(dataSize/4);
-
     // Load some memory to store decoded data
     // NOTE: Allocated enough size to include padding
-    unsigned char *decodedData = (unsigned char *)RL_CALLOC(maxOutputSize, 1);
+    int textSize = (int)strlen(text); // WARNING: Expecting NULL terminated strings!
+    int maxOutputSize = 3*((textSize + 3)/4);
+    unsigned char *decodedData = (unsigned char *)RL_MALLOC((maxOutputSize > 0)? maxOutputSize : 1);
     if (decodedData == NULL) return NULL;
 
-    int outputCount = 0;
-    for (int i = 0; i < dataSize;)
+    int decodedSize = DecodeDataBase64ToBuffer(text, textSize, decodedData, maxOutputSize);
+
+    if (decodedSize < 0)
     {
-        // Every 4 sixtets must generate 3 octets
-        if ((i + 2) >= dataSize)
-        {
-            TRACELOG(LOG_WARNING, "BASE64: Decoding error: Input data size is not valid");
-            break;
-        }
+        RL_FREE(decodedData);
+        return NULL;
+    }
+
+    *outputSize = decodedSize;
+    return decodedData;
+}
+
+// Decode Base64 text into a provided buffer
+// NOTE: Input is strictly validated, padding is optional, returns decoded size or -1 on failure
+int DecodeDataBase64ToBuffer(const char *text, int textSize, unsigned char *data, int dataCapacity)
+{
+    if ((text == NULL) || (textSize < 0)) return -1;
+
+    // Compute expected size, removing padding
+    int padding = 0;
+    while ((textSize > 0) && (padding < 2) && (text[textSize - 1] == '=')) { textSize--; padding++; }
+
+    int remainder = textSize%4;
+    if ((remainder == 1) || ((padding > 0) && (((textSize + padding)%4) != 0)))
+    {
+        TRACELOG(LOG_WARNING, "BASE64: Decoding error: Input data size is not valid");
+        return -1;
+    }
+
+    int dataSize = 3*(textSize/4) + ((remainder > 0)? (remainder - 1) : 0);
+    if (dataSize > dataCapacity)
+    {
+        TRACELOG(LOG_WARNING, "BASE64: Decoding error: Output data size is too small");
+        return -1;
+    }
 
+    // Decode full 4 sixtet groups with SIMD kernels (if available), remaining text with scalar path
+    int fullSize = textSize - remainder;
+    int i = DecodeBase64Blocks(text, fullSize, data, dataCapacity);
+    int outputCount = 3*(i/4);
+    bool valid = (i >= 0);
+
+    for (; valid && (i < fullSize); i += 4)
+    {
         unsigned int sixtetA = base64DecodeTable[(unsigned char)text[i]];
         unsigned int sixtetB = base64DecodeTable[(unsigned char)text[i + 1]];
-        unsigned int sixtetC = (((i + 2) < dataSize) && (unsigned char)text[i + 2] != '=')? base64DecodeTable[(unsigned char)text[i + 2]] : 0;
-        unsigned int sixtetD = (((i + 3) < dataSize) && (unsigned char)text[i + 3] != '=')? base64DecodeTable[(unsigned char)text[i + 3]] : 0;
+        unsigned int sixtetC = base64DecodeTable[(unsigned char)text[i + 2]];
+        unsigned int sixtetD = base64DecodeTable[(unsigned char)text[i + 3]];
 
-        unsigned int octetPack = (sixtetA << 18) | (sixtetB << 12)  | (sixtetC << 6) | sixtetD;
+        // NOTE: Invalid characters are mapped to 0xff, valid sixtets never set bit 7
+        if ((sixtetA | sixtetB | sixtetC | sixtetD) & 0x80) valid = false;
 
-        if ((outputCount + 3) > maxOutputSize)
-        {
-            TRACELOG(LOG_WARNING, "BASE64: Decoding error: Output data size is too small");
-            break;
-        }
+        unsigned int octetPack = (sixtetA << 18) | (sixtetB << 12) | (sixtetC << 6) | sixtetD;
 
-        decodedData[outputCount + 0] = (octetPack >> 16) & 0xff;
-        decodedData[outputCount + 1] = (octetPack >> 8) & 0xff;
-        decodedData[outputCount + 2] = octetPack & 0xff;
+        data[outputCount + 0] = (octetPack >> 16) & 0xff;
+        data[outputCount + 1] = (octetPack >> 8) & 0xff;
+        data[outputCount + 2] = octetPack & 0xff;
         outputCount += 3;
-        i += 4;
     }
 
-    if (estimatedOutputSize != (outputCount - padding)) TRACELOG(LOG_WARNING, "BASE64: Decoded size differs from estimation");
+    // Decode last 2 or 3 sixtets, generating 1 or 2 octets
+    if (valid && (remainder > 0))
+    {
+        unsigned int sixtetA = base64DecodeTable[(unsigned char)text[fullSize]];
+        unsigned int sixtetB = base64DecodeTable[(unsigned char)text[fullSize + 1]];
+        unsigned int sixtetC = (remainder == 3)? base64DecodeTable[(unsigned char)text[fullSize + 2]] : 0;
 
-    *outputSize = estimatedOutputSize;
-    return decodedData;
+        if ((sixtetA | sixtetB | sixtetC) & 0x80) valid = false;
+
+        unsigned int octetPack = (sixtetA << 18) | (sixtetB << 12) | (sixtetC << 6);
+
+        data[outputCount] = (octetPack >> 16) & 0xff;
+        if (remainder == 3) data[outputCount + 1] = (octetPack >> 8) & 0xff;
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "BASE64: Decoding error: Input data contains invalid characters");
+        return -1;
+    }
+
+    return dataSize;
 }
 
 // Compute CRC32 hash code
 unsigned int ComputeCRC32(unsigned char *data, int dataSize)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
-        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
-        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
-        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
-        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
-        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
-        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
-        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
-        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
-        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
-        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
-        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
-        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
-        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
-        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
-        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
-        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
-        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
-        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
-        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
-        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
-        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
-        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
-        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
-        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
-        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
-        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
-        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
-        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
-    };
-
-    unsigned int crc = ~0u;
-
-    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[data[i] ^ (crc & 0xff)];
-
-    return ~crc;
+    return ~UpdateCRC32(~0u, data, dataSize);
 }
 
 // Compute MD5 hash code
 // NOTE: Returns a static int[4] array (16 bytes)
 unsigned int *ComputeMD5(unsigned char *data, int dataSize)
 {
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
-
     static unsigned int hash[4] = { 0 };  // Hash to be returned
 
-    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
-
-    // NOTE: r specifies the per-round shift amounts
-    unsigned int r[] = {
-        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-    };
+    HashState state = InitHashState(HASH_MD5);
+    UpdateHashState(&state, data, dataSize);
+    FinishHashState(&state, hash);
 
-    // Using binary integer part of the sines of integers (in radians) as constants
-    unsigned int k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-    };
+    return hash;
+}
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+// Compute SHA-1 hash code
+// NOTE: Returns a static int[5] array (20 bytes)
+unsigned int *ComputeSHA1(unsigned char *data, int dataSize)
+{
+    static unsigned int hash[5] = { 0 };  // Hash to be returned
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+    HashState state = InitHashState(HASH_SHA1);
+    UpdateHashState(&state, data, dataSize);
+    FinishHashState(&state, hash);
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+    return hash;
+}
 
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64) - 8;
+// Compute SHA-256 hash code
+// NOTE: Returns a static int[8] array (32 bytes)
+unsigned int *ComputeSHA256(unsigned char *data, int dataSize)
+{
+    static unsigned int hash[8] = { 0 };  // Hash to be returned
 
-    unsigned char *msg = (unsigned char *)RL_CALLOC(newDataSize + 64, 1); // Initialize with '0' bits, allocating 64 extra bytes
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
+    HashState state = InitHashState(HASH_SHA256);
+    UpdateHashState(&state, data, dataSize);
+    FinishHashState(&state, hash);
 
-    unsigned int bitsLen = 8*dataSize;
-    memcpy(msg + newDataSize, &bitsLen, 4); // Append the len in bits at the end of the buffer
-
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+    return hash;
+}
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+// Init hash state for incremental hash computation
+HashState InitHashState(int type)
+{
+    HashState state = { 0 };
+    state.type = type;
 
-        for (int i = 0; i < 64; i++)
+    switch (type)
+    {
+        case HASH_CRC32: state.value[0] = ~0u; break;
+        case HASH_MD5:
         {
-            unsigned int f = 0;
-            unsigned int g = 0;
-
-            if (i < 16)
-            {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            }
-            else if (i < 32)
-            {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
-            {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
-            }
-            else
-            {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
-            }
-
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
-            a = temp;
-        }
-
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
+            state.value[0] = 0x67452301;
+            state.value[1] = 0xefcdab89;
+            state.value[2] = 0x98badcfe;
+            state.value[3] = 0x10325476;
+        } break;
+        case HASH_SHA1:
+        {
+            state.value[0] = 0x67452301;
+            state.value[1] = 0xEFCDAB89;
+            state.value[2] = 0x98BADCFE;
+            state.value[3] = 0x10325476;
+            state.value[4] = 0xC3D2E1F0;
+        } break;
+        case HASH_SHA256:
+        {
+            state.value[0] = 0x6A09e667;
+            state.value[1] = 0xbb67ae85;
+            state.value[2] = 0x3c6ef372;
+            state.value[3] = 0xa54ff53a;
+            state.value[4] = 0x510e527f;
+            state.value[5] = 0x9b05688c;
+            state.value[6] = 0x1f83d9ab;
+            state.value[7] = 0x5be0cd19;
+        } break;
+        default: TRACELOG(LOG_WARNING, "SYSTEM: Hash type not supported (%i)", type); break;
     }
 
-    RL_FREE(msg);
-
-    return hash;
+    return state;
 }
 
-// Compute SHA-1 hash code
-// NOTE: Returns a static int[5] array (20 bytes)
-unsigned int *ComputeSHA1(unsigned char *data, int dataSize)
+// Update hash state with a new chunk of data
+void UpdateHashState(HashState *state, const unsigned char *data, int dataSize)
 {
-    #define SHA1_ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
-
-    static unsigned int hash[5] = { 0 };  // Hash to be returned
+    if ((data == NULL) || (dataSize <= 0)) return;
 
-    // Initialize hash values
-    hash[0] = 0x67452301;
-    hash[1] = 0xEFCDAB89;
-    hash[2] = 0x98BADCFE;
-    hash[3] = 0x10325476;
-    hash[4] = 0xC3D2E1F0;
-
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
-
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
-
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64);
-
-    unsigned char *msg = (unsigned char *)RL_CALLOC(newDataSize, 1); // Initialize with '0' bits
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
-
-    unsigned long long bitsLen = 8ULL * dataSize;
-    msg[newDataSize-1] = (unsigned char)(bitsLen);
-    msg[newDataSize-2] = (unsigned char)(bitsLen >> 8);
-    msg[newDataSize-3] = (unsigned char)(bitsLen >> 16);
-    msg[newDataSize-4] = (unsigned char)(bitsLen >> 24);
-    msg[newDataSize-5] = (unsigned char)(bitsLen >> 32);
-    msg[newDataSize-6] = (unsigned char)(bitsLen >> 40);
-    msg[newDataSize-7] = (unsigned char)(bitsLen >> 48);
-    msg[newDataSize-8] = (unsigned char)(bitsLen >> 56);
-
-    // Process the message in successive 512-bit chunks
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
+    if (state->type == HASH_CRC32)
     {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int w[80] = { 0 };
-        for (int i = 0; i < 16; i++)
-        {
-            w[i] = (msg[offset + (i*4) + 0] << 24) |
-                   (msg[offset + (i*4) + 1] << 16) |
-                   (msg[offset + (i*4) + 2] << 8) |
-                   (msg[offset + (i*4) + 3]);
-        }
+        state->value[0] = UpdateCRC32(state->value[0], data, dataSize);
+        state->size += dataSize;
+        return;
+    }
 
-        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
-        for (int i = 16; i < 80; i++) w[i] = SHA1_ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+    int pending = (int)(state->size%64);
+    state->size += dataSize;
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
+    // Complete the pending block first, if any
+    if (pending > 0)
+    {
+        int fill = 64 - pending;
 
-        for (int i = 0; i < 80; i++)
+        if (dataSize < fill)
         {
-            unsigned int f = 0;
-            unsigned int k = 0;
-
-            if (i < 20)
-            {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
-            }
-            else if (i < 40)
-            {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            }
-            else if (i < 60)
-            {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
-            }
-            else
-            {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
-            }
-
-            unsigned int temp = SHA1_ROTATE_LEFT(a, 5) + f + e + k + w[i];
-            e = d;
-            d = c;
-            c = SHA1_ROTATE_LEFT(b, 30);
-            b = a;
-            a = temp;
+            memcpy(state->block + pending, data, dataSize);
+            return;
         }
 
-        // Add this chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
+        memcpy(state->block + pending, data, fill);
+        ProcessHashBlocks(state, state->block, 1);
+        data += fill;
+        dataSize -= fill;
     }
 
-    RL_FREE(msg);
-
-    return hash;
+    // Process full blocks directly from input data, keep the remainder for next update
+    int blockCount = dataSize/64;
+    if (blockCount > 0) ProcessHashBlocks(state, data, blockCount);
+    memcpy(state->block, data + blockCount*64, dataSize%64);
 }
 
-// Compute SHA-256 hash code
-// NOTE: Returns a static int[8] array (32 bytes)
-unsigned int *ComputeSHA256(unsigned char *data, int dataSize)
+// Finish hash computation, hash words written to provided array
+// NOTE: Required array size: CRC32: int[1], MD5: int[4], SHA-1: int[5], SHA-256: int[8]
+void FinishHashState(HashState *state, unsigned int *hash)
 {
-    #define SHA256_ROTATE_RIGHT(x, c) ((x >> c) | (x << ((sizeof(unsigned int)*8) - c)))
-    #define SHA256_A0(x) (SHA256_ROTATE_RIGHT(x, 7) ^ SHA256_ROTATE_RIGHT(x, 18) ^ (x >> 3))
-    #define SHA256_A1(x) (SHA256_ROTATE_RIGHT(x, 17) ^ SHA256_ROTATE_RIGHT(x, 19) ^ (x >> 10))
-
-    static const unsigned int k[64] = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-    };
-
-    static unsigned int hash[8] = { 0 };
-    hash[0] = 0x6A09e667;
-    hash[1] = 0xbb67ae85;
-    hash[2] = 0x3c6ef372;
-    hash[3] = 0xa54ff53a;
-    hash[4] = 0x510e527f;
-    hash[5] = 0x9b05688c;
-    hash[6] = 0x1f83d9ab;
-    hash[7] = 0x5be0cd19;
-
-    const unsigned long long int bitLen = ((unsigned long long int)dataSize)*8;
-    unsigned long long int paddedSize = dataSize + sizeof(dataSize);
-    paddedSize += (64 - (paddedSize%64));
-    unsigned char *buffer = (unsigned char *)RL_CALLOC(paddedSize, sizeof(unsigned char));
-
-    memcpy(buffer, data, dataSize);
-    buffer[dataSize] = 0x80;
-    for (int i = 1; i <= sizeof(bitLen); i++)
+    if (state->type == HASH_CRC32)
     {
-        buffer[(paddedSize - sizeof(bitLen)) + (i - 1)] = (bitLen >> (8*(sizeof(bitLen) - i))) & 0xFF;
+        hash[0] = ~state->value[0];
+        return;
     }
 
-    for (unsigned long long int blockN = 0; blockN < paddedSize/64; blockN++)
-    {
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
-        unsigned int f = hash[5];
-        unsigned int g = hash[6];
-        unsigned int h = hash[7];
-
-        unsigned char *block = buffer + (blockN*64);
-        unsigned int w[64] = { 0 };
-        for (int i = 0; i < 16; i++)
-        {
-            w[i] = ((unsigned int)block[i*4 + 0] << 24) |
-                   ((unsigned int)block[i*4 + 1] << 16) |
-                   ((unsigned int)block[i*4 + 2] << 8)  |
-                   ((unsigned int)block[i*4 + 3]);
-        }
-        for (int t = 16; t < 64; t++) w[t] = SHA256_A1(w[t - 2]) + w[t - 7] + SHA256_A0(w[t - 15]) + w[t - 16];
-
-        for (unsigned long long int t = 0; t < 64; t++)
-        {
-            unsigned int e1 = (SHA256_ROTATE_RIGHT(e, 6) ^ SHA256_ROTATE_RIGHT(e, 11) ^ SHA256_ROTATE_RIGHT(e, 25));
-            unsigned int ch = ((e & f) ^ (~e & g));
-            unsigned int t1 = (h + e1 + ch + k[t] + w[t]);
-            unsigned int e0 = (SHA256_ROTATE_RIGHT(a, 2) ^ SHA256_ROTATE_RIGHT(a, 13) ^ SHA256_ROTATE_RIGHT(a, 22));
-            unsigned int maj = ((a & b) ^ (a & c) ^ (b & c));
-            unsigned int t2 = e0 + maj;
+    // Pre-processing: append '1' bit, pad with '0' bits until message length
+    // in bits is 448 (mod 512) and append length in bits as 64 bit integer
+    unsigned char padding[128] = { 0 };
+    int pending = (int)(state->size%64);
+    int paddedSize = (pending < 56)? 64 : 128;
+    unsigned long long bitsLen = state->size*8;
 
-            h = g;
-            g = f;
-            f = e;
-            e = d + t1;
-            d = c;
-            c = b;
-            b = a;
-            a = t1 + t2;
-        }
+    memcpy(padding, state->block, pending);
+    padding[pending] = 0x80;
 
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
-        hash[5] += f;
-        hash[6] += g;
-        hash[7] += h;
+    for (int i = 0; i < 8; i++)
+    {
+        // NOTE: MD5 stores length as little-endian, SHA as big-endian
+        if (state->type == HASH_MD5) padding[paddedSize - 8 + i] = (unsigned char)(bitsLen >> (8*i));
+        else padding[paddedSize - 1 - i] = (unsigned char)(bitsLen >> (8*i));
     }
 
-    RL_FREE(buffer);
+    ProcessHashBlocks(state, padding, paddedSize/64);
 
-    return hash;
+    int hashCount = (state->type == HASH_MD5)? 4 : (state->type == HASH_SHA1)? 5 : (state->type == HASH_SHA256)? 8 : 0;
+    for (int i = 0; i < hashCount; i++) hash[i] = state->value[i];
 }
 
 //----------------------------------------------------------------------------------
@@ -4247,6 +4442,52 @@ void SetupViewport(int width, int height)
     rlLoadIdentity();                   // Reset current matrix (modelview)
 }
 
+// Set shader default locations (attributes and uniforms)
+// NOTE: shader.locs array must be previously allocated (RL_MAX_SHADER_LOCATIONS)
+static void SetShaderLocationsDefault(Shader *shader)
+{
+    // After custom shader loading, trying to set default location names
+    // Default shader attribute locations have been binded before linking:
+    //  - vertex position location    = 0
+    //  - vertex texcoord location    = 1
+    //  - vertex normal location      = 2
+    //  - vertex color location       = 3
+    //  - vertex tangent location     = 4
+    //  - vertex texcoord2 location   = 5
+    //  - vertex boneIndices location = 6
+    //  - vertex boneWeights location = 7
+
+    // NOTE: If any location is not found, loc point becomes -1
+
+    // NOTE: All locations set to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader->locs[i] = -1;
+
+    // Get handles to GLSL input attribute locations
+    shader->locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader->locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader->locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader->locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader->locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader->locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    shader->locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEINDICES);
+    shader->locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    shader->locs[SHADER_LOC_VERTEX_INSTANCETRANSFORM] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader->locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader->locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader->locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader->locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    shader->locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    shader->locs[SHADER_LOC_MATRIX_BONETRANSFORMS] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONEMATRICES);
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader->locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader->locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
+    shader->locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
+    shader->locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+}
+
 // Scan all files and directories in a base path
 // WARNING: files.paths[] must be previously allocated and
 // contain enough space to store all required paths
@@ -4303,6 +4544,1171 @@ static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const
     else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);  // Maybe it's a file...
 }
 
+// Update CRC32 (IEEE 802.3, reflected) state with provided data
+// NOTE: State is expected pre-inverted, hardware paths are selected at compile time
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize)
+{
+    // Slicing-by-8 tables, crcTable[0] is the classic byte-at-a-time table
+    static const unsigned int crcTable[8][256] = {
+        {
+            0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+            0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+            0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+            0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+            0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+            0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+            0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+            0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+            0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+            0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+            0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+            0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+            0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+            0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+            0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+            0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+            0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+            0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+            0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+            0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+            0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+            0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+            0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+            0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+            0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+            0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+            0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+            0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+            0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+            0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+            0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+            0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+        },
+        {
+            0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+            0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+            0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+            0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+            0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+            0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+            0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+            0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+            0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+            0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+            0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+            0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+            0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+            0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+            0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+            0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+            0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+            0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+            0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+            0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+            0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+            0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+            0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+            0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+            0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+            0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+            0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+            0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+            0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+            0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+            0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+            0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72
+        },
+        {
+            0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+            0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+            0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+            0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+            0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+            0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+            0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+            0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+            0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+            0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+            0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+            0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+            0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+            0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+            0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+            0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+            0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+            0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+            0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+            0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+            0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+            0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+            0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+            0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+            0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+            0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+            0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+            0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+            0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+            0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+            0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+            0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed
+        },
+        {
+            0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+            0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+            0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+            0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+            0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+            0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+            0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+            0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+            0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+            0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+            0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+            0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+            0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+            0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+            0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+            0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+            0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+            0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+            0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+            0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+            0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+            0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+            0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+            0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+            0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+            0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+            0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+            0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+            0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+            0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+            0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+            0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1
+        },
+        {
+            0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+            0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+            0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+            0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+            0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+            0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+            0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+            0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+            0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+            0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+            0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+            0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+            0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+            0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+            0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+            0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+            0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+            0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+            0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+            0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+            0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+            0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+            0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+            0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+            0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+            0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+            0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+            0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+            0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+            0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+            0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+            0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c
+        },
+        {
+            0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+            0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+            0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+            0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+            0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+            0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+            0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+            0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+            0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+            0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+            0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+            0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+            0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+            0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+            0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+            0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+            0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+            0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+            0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+            0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+            0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+            0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+            0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+            0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+            0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+            0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+            0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+            0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+            0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+            0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+            0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+            0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc
+        },
+        {
+            0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+            0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+            0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+            0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+            0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+            0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+            0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+            0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+            0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+            0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+            0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+            0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+            0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+            0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+            0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+            0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+            0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+            0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+            0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+            0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+            0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+            0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+            0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+            0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+            0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+            0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+            0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+            0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+            0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+            0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+            0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+            0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30
+        },
+        {
+            0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+            0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+            0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+            0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+            0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+            0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+            0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+            0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+            0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+            0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+            0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+            0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+            0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+            0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+            0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+            0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+            0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+            0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+            0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+            0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+            0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+            0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+            0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+            0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+            0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+            0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+            0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+            0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+            0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+            0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+            0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+            0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6
+        }
+    };
+
+#if defined(RL_CRC32_PCLMUL)
+    // Fold 64 bytes per iteration using carry-less multiplication, then Barrett reduce
+    // REF: Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+    if (dataSize >= 64)
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+        const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+        __m128i x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+        __m128i x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+        data += 64;
+        dataSize -= 64;
+
+        while (dataSize >= 64)
+        {
+            __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+            __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+            __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+            __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+            x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(data + 0x00)));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(data + 0x10)));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(data + 0x20)));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(data + 0x30)));
+
+            data += 64;
+            dataSize -= 64;
+        }
+
+        // Fold 512 bits into 128 bits, then remaining 16-byte blocks
+        __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), x5);
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), x5);
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), x5);
+
+        while (dataSize >= 16)
+        {
+            x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_loadu_si128((const __m128i *)data)), x5);
+            data += 16;
+            dataSize -= 16;
+        }
+
+        // Fold 128 bits into 64 bits
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), x2);
+
+        // Barrett reduction to 32 bits
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+        crc = (unsigned int)_mm_extract_epi32(_mm_xor_si128(x1, x2), 1);
+    }
+#elif defined(RL_CRC32_ARM)
+    while (dataSize >= 8)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, data, 8);
+        crc = __crc32d(crc, word);
+        data += 8;
+        dataSize -= 8;
+    }
+#endif
+
+    // Slicing-by-8, endianness independent since input words are assembled byte by byte
+    while (dataSize >= 8)
+    {
+        unsigned int lo = crc ^ ((unsigned int)data[0] | ((unsigned int)data[1] << 8) | ((unsigned int)data[2] << 16) | ((unsigned int)data[3] << 24));
+        unsigned int hi = (unsigned int)data[4] | ((unsigned int)data[5] << 8) | ((unsigned int)data[6] << 16) | ((unsigned int)data[7] << 24);
+
+        crc = crcTable[7][lo & 0xff] ^ crcTable[6][(lo >> 8) & 0xff] ^ crcTable[5][(lo >> 16) & 0xff] ^ crcTable[4][lo >> 24] ^
+              crcTable[3][hi & 0xff] ^ crcTable[2][(hi >> 8) & 0xff] ^ crcTable[1][(hi >> 16) & 0xff] ^ crcTable[0][hi >> 24];
+
+        data += 8;
+        dataSize -= 8;
+    }
+
+    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[0][data[i] ^ (crc & 0xff)];
+
+    return crc;
+}
+
+// Process MD5 64-byte blocks
+static void ProcessMD5Blocks(unsigned int *hash, const unsigned char *data, int blockCount)
+{
+    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+
+    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
+
+    // NOTE: r specifies the per-round shift amounts
+    static const unsigned int r[] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
+
+    // Using binary integer part of the sines of integers (in radians) as constants
+    static const unsigned int k[] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        // Break chunk into sixteen 32-bit little-endian words w[j], 0 <= j <= 15
+        unsigned int w[16] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[i*4 + 0]) |
+                   ((unsigned int)data[i*4 + 1] << 8) |
+                   ((unsigned int)data[i*4 + 2] << 16) |
+                   ((unsigned int)data[i*4 + 3] << 24);
+        }
+
+        // Initialize hash value for this chunk
+        unsigned int a = hash[0];
+        unsigned int b = hash[1];
+        unsigned int c = hash[2];
+        unsigned int d = hash[3];
+
+        for (int i = 0; i < 64; i++)
+        {
+            unsigned int f = 0;
+            unsigned int g = 0;
+
+            if (i < 16)
+            {
+                f = (b & c) | ((~b) & d);
+                g = i;
+            }
+            else if (i < 32)
+            {
+                f = (d & b) | ((~d) & c);
+                g = (5*i + 1)%16;
+            }
+            else if (i < 48)
+            {
+                f = b ^ c ^ d;
+                g = (3*i + 5)%16;
+            }
+            else
+            {
+                f = c ^ (b | (~d));
+                g = (7*i)%16;
+            }
+
+            unsigned int temp = d;
+            d = c;
+            c = b;
+            b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
+            a = temp;
+        }
+
+        // Add chunk's hash to result so far
+        hash[0] += a;
+        hash[1] += b;
+        hash[2] += c;
+        hash[3] += d;
+    }
+}
+
+// Process SHA-1 64-byte blocks
+static void ProcessSHA1Blocks(unsigned int *hash, const unsigned char *data, int blockCount)
+{
+#if defined(RL_SHA_X86)
+    // SHA-NI path, 4 rounds per instruction, message schedule also computed in hardware
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)hash), 0x1B);
+    __m128i e0 = _mm_set_epi32((int)hash[4], 0, 0, 0);
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        __m128i abcdSave = abcd;
+        __m128i e0Save = e0;
+        __m128i e[2] = { e0, e0 };
+        __m128i w[4] = { 0 };
+
+        for (int i = 0; i < 4; i++) w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16*i)), mask);
+
+        for (int g = 0; g < 20; g++)
+        {
+            if (g == 0) e[0] = _mm_add_epi32(e[0], w[0]);
+            else e[g & 1] = _mm_sha1nexte_epu32(e[g & 1], w[g & 3]);
+            e[(g + 1) & 1] = abcd;
+
+            if ((g >= 3) && (g < 19)) w[(g + 1) & 3] = _mm_sha1msg2_epu32(w[(g + 1) & 3], w[g & 3]);
+
+            switch (g/5)
+            {
+                case 0: abcd = _mm_sha1rnds4_epu32(abcd, e[g & 1], 0); break;
+                case 1: abcd = _mm_sha1rnds4_epu32(abcd, e[g & 1], 1); break;
+                case 2: abcd = _mm_sha1rnds4_epu32(abcd, e[g & 1], 2); break;
+                default: abcd = _mm_sha1rnds4_epu32(abcd, e[g & 1], 3); break;
+            }
+
+            if ((g >= 1) && (g < 17)) w[(g + 3) & 3] = _mm_sha1msg1_epu32(w[(g + 3) & 3], w[g & 3]);
+            if ((g >= 2) && (g < 18)) w[(g + 2) & 3] = _mm_xor_si128(w[(g + 2) & 3], w[g & 3]);
+        }
+
+        e0 = _mm_sha1nexte_epu32(e[0], e0Save);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    _mm_storeu_si128((__m128i *)hash, _mm_shuffle_epi32(abcd, 0x1B));
+    hash[4] = (unsigned int)_mm_extract_epi32(e0, 3);
+#elif defined(RL_SHA_ARM)
+    // ARMv8 crypto extensions path
+    static const unsigned int k[4] = { 0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6 };
+    uint32x4_t abcd = vld1q_u32(hash);
+    uint32_t e = hash[4];
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        uint32x4_t abcdSave = abcd;
+        uint32_t eSave = e;
+        uint32x4_t w[4];
+
+        for (int i = 0; i < 4; i++) w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16*i)));
+
+        for (int g = 0; g < 20; g++)
+        {
+            uint32x4_t wk = vaddq_u32(w[g & 3], vdupq_n_u32(k[g/5]));
+            uint32_t eNext = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+
+            if (g < 5) abcd = vsha1cq_u32(abcd, e, wk);
+            else if ((g >= 10) && (g < 15)) abcd = vsha1mq_u32(abcd, e, wk);
+            else abcd = vsha1pq_u32(abcd, e, wk);
+            e = eNext;
+
+            if (g < 16) w[g & 3] = vsha1su1q_u32(vsha1su0q_u32(w[g & 3], w[(g + 1) & 3], w[(g + 2) & 3]), w[(g + 3) & 3]);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSave);
+        e += eSave;
+    }
+
+    vst1q_u32(hash, abcd);
+    hash[4] = e;
+#else
+    #define SHA1_ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
+        unsigned int w[80] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[(i*4) + 0] << 24) |
+                   ((unsigned int)data[(i*4) + 1] << 16) |
+                   ((unsigned int)data[(i*4) + 2] << 8) |
+                   ((unsigned int)data[(i*4) + 3]);
+        }
+
+        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
+        for (int i = 16; i < 80; i++) w[i] = SHA1_ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+
+        // Initialize hash value for this chunk
+        unsigned int a = hash[0];
+        unsigned int b = hash[1];
+        unsigned int c = hash[2];
+        unsigned int d = hash[3];
+        unsigned int e = hash[4];
+
+        for (int i = 0; i < 80; i++)
+        {
+            unsigned int f = 0;
+            unsigned int k = 0;
+
+            if (i < 20)
+            {
+                f = (b & c) | ((~b) & d);
+                k = 0x5A827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+
+            unsigned int temp = SHA1_ROTATE_LEFT(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = SHA1_ROTATE_LEFT(b, 30);
+            b = a;
+            a = temp;
+        }
+
+        // Add this chunk's hash to result so far
+        hash[0] += a;
+        hash[1] += b;
+        hash[2] += c;
+        hash[3] += d;
+        hash[4] += e;
+    }
+#endif
+}
+
+// Process SHA-256 64-byte blocks
+static void ProcessSHA256Blocks(unsigned int *hash, const unsigned char *data, int blockCount)
+{
+    static const unsigned int k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+#if defined(RL_SHA_X86)
+    // SHA-NI path, state kept as ABEF/CDGH pairs as required by sha256rnds2
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&hash[0]), 0xB1);   // CDAB
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&hash[4]), 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);     // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);           // CDGH
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        __m128i abefSave = state0;
+        __m128i cdghSave = state1;
+        __m128i w[4] = { 0 };
+
+        for (int i = 0; i < 4; i++) w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16*i)), mask);
+
+        for (int i = 0; i < 16; i++)
+        {
+            __m128i msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *)&k[4*i]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+
+            if ((i >= 3) && (i < 15))
+            {
+                w[(i + 1) & 3] = _mm_add_epi32(w[(i + 1) & 3], _mm_alignr_epi8(w[i & 3], w[(i + 3) & 3], 4));
+                w[(i + 1) & 3] = _mm_sha256msg2_epu32(w[(i + 1) & 3], w[i & 3]);
+            }
+
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+
+            if ((i >= 1) && (i < 13)) w[(i + 3) & 3] = _mm_sha256msg1_epu32(w[(i + 3) & 3], w[i & 3]);
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);                 // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);              // DCHG
+    _mm_storeu_si128((__m128i *)&hash[0], _mm_blend_epi16(tmp, state1, 0xF0));  // DCBA
+    _mm_storeu_si128((__m128i *)&hash[4], _mm_alignr_epi8(state1, tmp, 8));     // HGFE
+#elif defined(RL_SHA_ARM)
+    // ARMv8 crypto extensions path
+    uint32x4_t state0 = vld1q_u32(&hash[0]);
+    uint32x4_t state1 = vld1q_u32(&hash[4]);
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        uint32x4_t abcdSave = state0;
+        uint32x4_t efghSave = state1;
+        uint32x4_t w[4];
+
+        for (int i = 0; i < 4; i++) w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16*i)));
+
+        for (int i = 0; i < 16; i++)
+        {
+            uint32x4_t wk = vaddq_u32(w[i & 3], vld1q_u32(&k[4*i]));
+            uint32x4_t abcd = state0;
+
+            if (i < 12) w[i & 3] = vsha256su0q_u32(w[i & 3], w[(i + 1) & 3]);
+            state0 = vsha256hq_u32(state0, state1, wk);
+            state1 = vsha256h2q_u32(state1, abcd, wk);
+            if (i < 12) w[i & 3] = vsha256su1q_u32(w[i & 3], w[(i + 2) & 3], w[(i + 3) & 3]);
+        }
+
+        state0 = vaddq_u32(state0, abcdSave);
+        state1 = vaddq_u32(state1, efghSave);
+    }
+
+    vst1q_u32(&hash[0], state0);
+    vst1q_u32(&hash[4], state1);
+#else
+    #define SHA256_ROTATE_RIGHT(x, c) ((x >> c) | (x << ((sizeof(unsigned int)*8) - c)))
+    #define SHA256_A0(x) (SHA256_ROTATE_RIGHT(x, 7) ^ SHA256_ROTATE_RIGHT(x, 18) ^ (x >> 3))
+    #define SHA256_A1(x) (SHA256_ROTATE_RIGHT(x, 17) ^ SHA256_ROTATE_RIGHT(x, 19) ^ (x >> 10))
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        unsigned int a = hash[0];
+        unsigned int b = hash[1];
+        unsigned int c = hash[2];
+        unsigned int d = hash[3];
+        unsigned int e = hash[4];
+        unsigned int f = hash[5];
+        unsigned int g = hash[6];
+        unsigned int h = hash[7];
+
+        unsigned int w[64] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[i*4 + 0] << 24) |
+                   ((unsigned int)data[i*4 + 1] << 16) |
+                   ((unsigned int)data[i*4 + 2] << 8)  |
+                   ((unsigned int)data[i*4 + 3]);
+        }
+        for (int t = 16; t < 64; t++) w[t] = SHA256_A1(w[t - 2]) + w[t - 7] + SHA256_A0(w[t - 15]) + w[t - 16];
+
+        for (int t = 0; t < 64; t++)
+        {
+            unsigned int e1 = (SHA256_ROTATE_RIGHT(e, 6) ^ SHA256_ROTATE_RIGHT(e, 11) ^ SHA256_ROTATE_RIGHT(e, 25));
+            unsigned int ch = ((e & f) ^ (~e & g));
+            unsigned int t1 = (h + e1 + ch + k[t] + w[t]);
+            unsigned int e0 = (SHA256_ROTATE_RIGHT(a, 2) ^ SHA256_ROTATE_RIGHT(a, 13) ^ SHA256_ROTATE_RIGHT(a, 22));
+            unsigned int maj = ((a & b) ^ (a & c) ^ (b & c));
+            unsigned int t2 = e0 + maj;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        hash[0] += a;
+        hash[1] += b;
+        hash[2] += c;
+        hash[3] += d;
+        hash[4] += e;
+        hash[5] += f;
+        hash[6] += g;
+        hash[7] += h;
+    }
+#endif
+}
+
+// Process full 64-byte blocks for block-based hash types
+static void ProcessHashBlocks(HashState *state, const unsigned char *data, int blockCount)
+{
+    switch (state->type)
+    {
+        case HASH_MD5: ProcessMD5Blocks(state->value, data, blockCount); break;
+        case HASH_SHA1: ProcessSHA1Blocks(state->value, data, blockCount); break;
+        case HASH_SHA256: ProcessSHA256Blocks(state->value, data, blockCount); break;
+        default: break;
+    }
+}
+
+// Encode full 3 byte groups to Base64 using SIMD kernels (if available)
+// NOTE: Returns the number of input bytes encoded (multiple of 3), output must fit 4*(dataSize/3) chars
+static int EncodeBase64Blocks(const unsigned char *data, int dataSize, char *output)
+{
+    int i = 0;
+    int o = 0;
+
+#if defined(RL_BASE64_NEON)
+    // 48 bytes into 64 chars per iteration, de-interleaving loads and 64-entry table lookups
+    uint8x16x4_t table = { { vld1q_u8((const uint8_t *)base64EncodeTable), vld1q_u8((const uint8_t *)base64EncodeTable + 16),
+                             vld1q_u8((const uint8_t *)base64EncodeTable + 32), vld1q_u8((const uint8_t *)base64EncodeTable + 48) } };
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+
+    for (; (i + 48) <= dataSize; i += 48, o += 64)
+    {
+        uint8x16x3_t in = vld3q_u8(data + i);
+        uint8x16x4_t out;
+
+        out.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        out.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+        out.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], mask));
+
+        vst4q_u8((uint8_t *)output + o, out);
+    }
+#endif
+#if defined(RL_BASE64_AVX2)
+    // 24 bytes into 32 chars per iteration, two 12 byte groups per 128-bit lane
+    // NOTE: Each lane loads 16 bytes, so 4 extra readable bytes are required
+    for (; (i + 28) <= dataSize; i += 24, o += 32)
+    {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(data + i))),
+                                             _mm_loadu_si128((const __m128i *)(data + i + 12)), 1);
+
+        in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                       1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+        // Unpack every 3 bytes into 4 sixtets
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i sixtets = _mm256_or_si256(t0, t1);
+
+        // Map sixtets to ASCII, adding an offset per range: [0..25] 'A', [26..51] 'a', [52..61] '0', 62 '+', 63 '/'
+        __m256i shift = _mm256_set1_epi8('A');
+        shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(sixtets, _mm256_set1_epi8(25)), _mm256_set1_epi8('a' - 26 - 'A')));
+        shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(sixtets, _mm256_set1_epi8(51)), _mm256_set1_epi8('0' - 52 - 'a' + 26)));
+        shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpeq_epi8(sixtets, _mm256_set1_epi8(62)), _mm256_set1_epi8('+' - 62 - '0' + 52)));
+        shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpeq_epi8(sixtets, _mm256_set1_epi8(63)), _mm256_set1_epi8('/' - 63 - '0' + 52)));
+
+        _mm256_storeu_si256((__m256i *)(output + o), _mm256_add_epi8(sixtets, shift));
+    }
+#endif
+#if defined(RL_BASE64_SSSE3)
+    // 12 bytes into 16 chars per iteration
+    // NOTE: Loads 16 bytes, so 4 extra readable bytes are required
+    for (; (i + 16) <= dataSize; i += 12, o += 16)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i *)(data + i));
+        in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+        // Unpack every 3 bytes into 4 sixtets
+        __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        __m128i sixtets = _mm_or_si128(t0, t1);
+
+        // Map sixtets to ASCII, adding an offset per range: [0..25] 'A', [26..51] 'a', [52..61] '0', 62 '+', 63 '/'
+        __m128i shift = _mm_set1_epi8('A');
+        shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(sixtets, _mm_set1_epi8(25)), _mm_set1_epi8('a' - 26 - 'A')));
+        shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(sixtets, _mm_set1_epi8(51)), _mm_set1_epi8('0' - 52 - 'a' + 26)));
+        shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpeq_epi8(sixtets, _mm_set1_epi8(62)), _mm_set1_epi8('+' - 62 - '0' + 52)));
+        shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpeq_epi8(sixtets, _mm_set1_epi8(63)), _mm_set1_epi8('/' - 63 - '0' + 52)));
+
+        _mm_storeu_si128((__m128i *)(output + o), _mm_add_epi8(sixtets, shift));
+    }
+#endif
+    (void)data;
+    (void)dataSize;
+    (void)output;
+    (void)o;
+
+    return i;
+}
+
+// Decode full 4 sixtet groups from Base64 using SIMD kernels (if available)
+// NOTE: Returns the number of input chars decoded (multiple of 4), -1 if invalid characters found
+static int DecodeBase64Blocks(const char *text, int textSize, unsigned char *output, int outputCapacity)
+{
+    int i = 0;
+    int o = 0;
+
+#if defined(RL_BASE64_NEON)
+    // 64 chars into 48 bytes per iteration, ASCII [0..127] mapped with two 64-entry table lookups
+    uint8x16x4_t tableLo = { { vld1q_u8(base64DecodeTable), vld1q_u8(base64DecodeTable + 16), vld1q_u8(base64DecodeTable + 32), vld1q_u8(base64DecodeTable + 48) } };
+    uint8x16x4_t tableHi = { { vld1q_u8(base64DecodeTable + 64), vld1q_u8(base64DecodeTable + 80), vld1q_u8(base64DecodeTable + 96), vld1q_u8(base64DecodeTable + 112) } };
+    uint8x16_t error = vdupq_n_u8(0);
+
+    for (; ((i + 64) <= textSize) && ((o + 48) <= outputCapacity); i += 64, o += 48)
+    {
+        uint8x16x4_t in = vld4q_u8((const uint8_t *)text + i);
+        uint8x16x3_t out;
+
+        for (int k = 0; k < 4; k++)
+        {
+            // NOTE: Out of range indices return 0 on each lookup, chars over 127 are flagged separately
+            uint8x16_t c = in.val[k];
+            in.val[k] = vorrq_u8(vqtbl4q_u8(tableLo, c), vqtbl4q_u8(tableHi, vsubq_u8(c, vdupq_n_u8(64))));
+            error = vorrq_u8(error, vorrq_u8(vcgtq_u8(in.val[k], vdupq_n_u8(63)), vcgeq_u8(c, vdupq_n_u8(128))));
+        }
+
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+
+        vst3q_u8(output + o, out);
+    }
+
+    if (vmaxvq_u8(error) != 0) return -1;
+#endif
+#if defined(RL_BASE64_AVX2)
+    // 32 chars into 24 bytes per iteration
+    // NOTE: Stores 16 bytes per lane, so 4 extra writable bytes are required
+    for (; ((i + 32) <= textSize) && ((o + 28) <= outputCapacity); i += 32, o += 24)
+    {
+        __m256i c = _mm256_loadu_si256((const __m256i *)(text + i));
+        // Map ASCII to sixtets, adding an offset per range: 'A'..'Z', 'a'..'z', '0'..'9', '+', '/'
+        // NOTE: Signed compares reject chars over 127, any char out of every range is invalid
+        __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+        __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+        __m256i plus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'));
+        __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+        __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, plus)), slash);
+
+        __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')));
+        __m256i sixtets = _mm256_add_epi8(c, shift);
+
+        if (_mm256_movemask_epi8(valid) != -1) return -1;
+
+        // Pack 4 sixtets into 3 bytes: [00aaaaaa|00bbbbbb|00cccccc|00dddddd] -> [aaaaaabb|bbbbcccc|ccdddddd]
+        __m256i packed = _mm256_madd_epi16(_mm256_maddubs_epi16(sixtets, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        packed = _mm256_shuffle_epi8(packed, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                               2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i *)(output + o), _mm256_castsi256_si128(packed));
+        _mm_storeu_si128((__m128i *)(output + o + 12), _mm256_extracti128_si256(packed, 1));
+    }
+#endif
+#if defined(RL_BASE64_SSSE3)
+    // 16 chars into 12 bytes per iteration
+    // NOTE: Stores 16 bytes, so 4 extra writable bytes are required
+    for (; ((i + 16) <= textSize) && ((o + 16) <= outputCapacity); i += 16, o += 12)
+    {
+        __m128i c = _mm_loadu_si128((const __m128i *)(text + i));
+        // Map ASCII to sixtets, adding an offset per range: 'A'..'Z', 'a'..'z', '0'..'9', '+', '/'
+        // NOTE: Signed compares reject chars over 127, any char out of every range is invalid
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), c));
+        __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), c));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), c));
+        __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+        __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+        __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+
+        __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+        shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        shift = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+        shift = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+        __m128i sixtets = _mm_add_epi8(c, shift);
+
+        if (_mm_movemask_epi8(valid) != 0xffff) return -1;
+
+        // Pack 4 sixtets into 3 bytes: [00aaaaaa|00bbbbbb|00cccccc|00dddddd] -> [aaaaaabb|bbbbcccc|ccdddddd]
+        __m128i packed = _mm_madd_epi16(_mm_maddubs_epi16(sixtets, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        packed = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i *)(output + o), packed);
+    }
+#endif
+    (void)text;
+    (void)textSize;
+    (void)output;
+    (void)outputCapacity;
+    (void)o;
+
+    return i;
+}
+
+#if SUPPORT_FILE_WATCHER
+// Compute file path hash (FNV-1a), length -1 for NULL terminated paths
+static unsigned int ComputeFileWatcherHash(const char *path, int length)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; (length < 0)? (path[i] != '\0') : (i < length); i++)
+    {
+        hash ^= (unsigned char)path[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Find watched file index by path, -1 if not found
+static int FindWatchedFile(const char *path, unsigned int hash)
+{
+    if (watcher.tableSize == 0) return -1;
+
+    unsigned int mask = watcher.tableSize - 1;
+
+    for (unsigned int slot = hash & mask; watcher.table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        const WatchedFile *file = &watcher.files[watcher.table[slot] - 1];
+        if ((file->hash == hash) && (strcmp(file->path, path) == 0)) return watcher.table[slot] - 1;
+    }
+
+    return -1;
+}
+
+// Build watched files hash table, required after files array changes
+static void BuildFileWatcherTable(void)
+{
+    int size = (watcher.tableSize > 0)? watcher.tableSize : 128;
+    while (watcher.fileCount*2 > size) size *= 2;
+
+    if (size != watcher.tableSize)
+    {
+        RL_FREE(watcher.table);
+        watcher.table = (int *)RL_MALLOC(size*sizeof(int));
+        watcher.tableSize = size;
+    }
+
+    memset(watcher.table, 0, watcher.tableSize*sizeof(int));
+
+    unsigned int mask = watcher.tableSize - 1;
+
+    for (int i = 0; i < watcher.fileCount; i++)
+    {
+        unsigned int slot = watcher.files[i].hash & mask;
+        while (watcher.table[slot] != 0) slot = (slot + 1) & mask;
+        watcher.table[slot] = i + 1;
+    }
+}
+
+// Register change event for a watched file, pending to be reported
+// NOTE: New events on a pending file restart its coalesce time
+static void SetWatchedFileChanged(int index, double time)
+{
+    if (watcher.files[index].eventTime == 0.0) watcher.pending[watcher.pendingCount++] = index;
+    watcher.files[index].eventTime = time;
+}
+
+// Update file watcher: read change events, poll files and report coalesced changes
+static void UpdateFileWatcher(void)
+{
+    double time = GetTime();
+    if (time <= 0.0) time = 1e-9;       // Event time 0.0 is reserved for no pending changes
+
+#if defined(FILE_WATCHER_INOTIFY)
+    if (watcher.fd >= 0)
+    {
+        // NOTE: Buffer aligned to read inotify_event structures
+        char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+        ssize_t length = 0;
+        while ((length = read(watcher.fd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char *ptr = buffer; ptr < buffer + length; ptr += sizeof(struct inotify_event) + ((struct inotify_event *)ptr)->len)
+            {
+                const struct inotify_event *event = (const struct inotify_event *)ptr;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    // Events lost, all watched files are considered changed
+                    TRACELOG(LOG_WARNING, "FILEIO: File watcher events queue overflow, reloading all watched files");
+                    for (int i = 0; i < watcher.fileCount; i++) SetWatchedFileChanged(i, time);
+                    continue;
+                }
+
+                for (int d = 0; d < watcher.dirCount; d++)
+                {
+                    WatchedDirectory *dir = &watcher.dirs[d];
+                    if (dir->wd != event->wd) continue;
+
+                    if (event->mask & IN_IGNORED)
+                    {
+                        // Directory watch removed (i.e. directory deleted), keep watching its files by polling
+                        dir->wd = -1;
+                        watcher.polledCount += dir->fileCount;
+                        continue;
+                    }
+
+                    if (event->len == 0) continue;
+
+                    int dirLength = (int)strlen(dir->path);
+                    int nameLength = (int)strlen(event->name);
+                    if (dirLength + nameLength >= MAX_FILEPATH_LENGTH) continue;
+
+                    memcpy(path, dir->path, dirLength);
+                    memcpy(path + dirLength, event->name, nameLength + 1);
+
+                    int index = FindWatchedFile(path, ComputeFileWatcherHash(path, dirLength + nameLength));
+                    if (index >= 0) SetWatchedFileChanged(index, time);
+                }
+            }
+        }
+    }
+#endif
+
+    // Poll files not covered by a directory watch, a limited number per frame
+    if (watcher.polledCount > 0)
+    {
+        struct stat info = { 0 };
+
+        for (int i = 0, checked = 0; (i < watcher.fileCount) && (checked < FILE_WATCHER_POLL_COUNT); i++)
+        {
+            if (watcher.pollIndex >= watcher.fileCount) watcher.pollIndex = 0;
+
+            int index = watcher.pollIndex++;
+            WatchedFile *file = &watcher.files[index];
+            if (watcher.dirs[file->dirIndex].wd >= 0) continue;
+
+            checked++;
+
+            if ((stat(file->path, &info) == 0) && (((long)info.st_mtime != file->modTime) || ((long)info.st_size != file->size)))
+            {
+                file->modTime = (long)info.st_mtime;
+                file->size = (long)info.st_size;
+                SetWatchedFileChanged(index, time);
+            }
+        }
+    }
+
+    // Report pending files without new events on coalesce time
+    for (int i = 0; i < watcher.pendingCount; i++)
+    {
+        WatchedFile *file = &watcher.files[watcher.pending[i]];
+        if ((time - file->eventTime) < FILE_WATCHER_COALESCE_TIME) continue;
+
+        file->eventTime = 0.0;
+        watcher.pending[i--] = watcher.pending[--watcher.pendingCount];
+
+        if (file->changed) continue;
+
+        if (watcher.changed.count == watcher.changedCapacity)
+        {
+            unsigned int capacity = (watcher.changedCapacity > 0)? watcher.changedCapacity*2 : 16;
+            char **paths = (char **)RL_REALLOC(watcher.changed.paths, capacity*sizeof(char *));
+            if (paths == NULL) break;
+
+            watcher.changed.paths = paths;
+            watcher.changedCapacity = capacity;
+        }
+
+        watcher.changed.paths[watcher.changed.count] = (char *)RL_MALLOC(strlen(file->path) + 1);
+        strcpy(watcher.changed.paths[watcher.changed.count], file->path);
+        watcher.changed.count++;
+        file->changed = true;
+    }
+}
+
+// Close file watcher and free all watched files data
+static void CloseFileWatcher(void)
+{
+    if (!watcher.ready) return;
+
+#if defined(FILE_WATCHER_INOTIFY)
+    if (watcher.fd >= 0) close(watcher.fd);     // NOTE: Closing inotify instance removes all its watches
+#endif
+
+    for (int i = 0; i < watcher.fileCount; i++) RL_FREE(watcher.files[i].path);
+    for (int i = 0; i < watcher.dirCount; i++) RL_FREE(watcher.dirs[i].path);
+    for (unsigned int i = 0; i < watcher.changed.count; i++) RL_FREE(watcher.changed.paths[i]);
+
+    RL_FREE(watcher.files);
+    RL_FREE(watcher.dirs);
+    RL_FREE(watcher.table);
+    RL_FREE(watcher.pending);
+    RL_FREE(watcher.changed.paths);
+
+    memset(&watcher, 0, sizeof(FileWatcher));
+}
+#endif
+
 #if SUPPORT_AUTOMATION_EVENTS
 // Automation event recording
 // Checking events in current frame and save them into currentEventList
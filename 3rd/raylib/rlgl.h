@@ -50,9 +50,12 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS 64   // Maximum number of layers of every batch texture array (rlLoadBatchTextureLayer())
+*       #define RL_MAX_BATCH_TEXTURE_ARRAYS           8    // Maximum number of batch texture arrays (one per texture size and format)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_CACHE_PATH_LENGTH     512    // Maximum length of shader program binary cache directory path
 *       #define RL_CULL_DISTANCE_NEAR              0.05    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             4000.0    // Default projection matrix far cull distance
 *
@@ -67,6 +70,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEINDICES  "vertexBoneIndices" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEINDICES
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXLAYER     "vertexTexLayer"    // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -219,6 +223,12 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS
+    #define RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS   64      // Maximum number of layers of every batch texture array (rlLoadBatchTextureLayer())
+#endif
+#ifndef RL_MAX_BATCH_TEXTURE_ARRAYS
+    #define RL_MAX_BATCH_TEXTURE_ARRAYS              8      // Maximum number of batch texture arrays (one per texture size and format)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -229,6 +239,9 @@
 #ifndef RL_MAX_SHADER_LOCATIONS
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
+#ifndef RL_MAX_SHADER_CACHE_PATH_LENGTH
+    #define RL_MAX_SHADER_CACHE_PATH_LENGTH        512      // Maximum length of shader program binary cache directory path
+#endif
 
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
@@ -354,6 +367,9 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCETRANSFORM
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCETRANSFORM 9
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER    13    // Instance transform matrix takes locations 9 to 12
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -384,6 +400,7 @@ typedef struct rlVertexBuffer {
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    float *texlayers;           // Vertex texture array layer (1 component per vertex), used by batch texture arrays (shader-location = 13)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -391,7 +408,7 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vboId[6];      // OpenGL Vertex Buffer Objects id (6 types of vertex data)
 } rlVertexBuffer;
 
 // Draw call type
@@ -756,6 +773,8 @@ RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width,
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
+RLAPI bool rlLoadBatchTextureLayer(unsigned int id, int width, int height, int format); // Copy texture into a batch texture array layer, batching its draws with same size and format textures (OpenGL 3.3, ES3)
+RLAPI void rlUnloadBatchTextureArrays(void);                              // Unload batch texture arrays, textures are drawn on their own again
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
@@ -774,6 +793,11 @@ RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RLAPI bool rlReloadShaderCode(unsigned int id, const char *vsCode, const char *fsCode); // Reload shader program from code strings, keeps program id (on failure, program is not modified)
+RLAPI void rlSetShaderCacheDirectory(const char *path);                         // Set shader program binary cache directory (NULL to disable), used by rlLoadShaderCode()
+RLAPI void rlLoadShaderCodeBatch(const char **vsCodes, const char **fsCodes, int count, unsigned int *ids); // Load multiple shaders from code strings, compile and link are submitted without waiting for completion
+RLAPI bool rlIsShaderProgramReady(unsigned int id);                             // Check if shader program compile and link completed, never blocks (requires GL_KHR_parallel_shader_compile)
+RLAPI unsigned int rlFinishShaderProgram(unsigned int id);                      // Finish shader program loading, blocks until completed, returns default shader id on failure
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform, requires shader program id
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute, requires shader program id
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count); // Set shader value uniform
@@ -900,6 +924,7 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: calloc(), free()
+#include <stdio.h>                      // Required for: fopen(), fread(), fwrite(), fclose(), snprintf() [Used in shader program binary cache]
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
@@ -1019,6 +1044,14 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM "instanceTransform" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCETRANSFORM
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXLAYER
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXLAYER     "vertexTexLayer"    // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER
+#endif
+
+// Batch texture arrays require GL_TEXTURE_2D_ARRAY textures and GLSL sampler2DArray (OpenGL 3.3, OpenGL ES 3.0)
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    #define RLGL_BATCH_TEXTURE_ARRAYS
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1058,6 +1091,42 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+// Shader program uniform data
+typedef struct rlShaderUniform {
+    unsigned int hash;                      // Uniform name hash (FNV-1a)
+    int nameOffset;                         // Uniform name offset into names buffer
+    int nameBaseLength;                     // Uniform array base name length, name without "[0]" suffix (0 if not an array)
+    int location;                           // Uniform location (-1 for uniform block members)
+    int valueOffset;                        // Uniform value offset into values shadow copy
+    int valueSize;                          // Uniform value size in bytes (all array elements)
+    int validSize;                          // Uniform value bytes set through rlgl, valid for comparison (0: unknown value)
+    int uploadMode;                         // Uniform value upload mode for valid bytes (0: default, 1: transposed matrices)
+} rlShaderUniform;
+
+// Shader program uniforms table, loaded from GL_ACTIVE_UNIFORMS after program linkage
+// NOTE: Used for hashed uniform location queries and to skip redundant uniform value uploads
+typedef struct rlShaderUniforms {
+    int uniformCount;                       // Active uniforms count
+    rlShaderUniform *uniforms;              // Active uniforms data
+    int slotCount;                          // Name hash table size (power of two)
+    int *slots;                             // Name hash table, uniform index (-1: empty slot)
+    int locationCount;                      // Location indices size (max location + 1)
+    int *locationIndices;                   // Uniform index by location (-1: not an uniform base location)
+    char *names;                            // Uniform names buffer (NULL terminated strings)
+    unsigned char *values;                  // Uniform values shadow copy
+} rlShaderUniforms;
+
+// Batch texture array, layers are copies of same size and format textures
+// NOTE: Draws using any of those textures share the array, the layer is provided by vertex
+typedef struct rlBatchTextureArray {
+    unsigned int id;                        // OpenGL texture array id (GL_TEXTURE_2D_ARRAY)
+    int width;                              // Layers width
+    int height;                             // Layers height
+    int format;                             // Layers pixel format (PixelFormat type)
+    int layerCount;                         // Used layers count
+    int layerCapacity;                      // Allocated layers count, doubled when full up to RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS
+} rlBatchTextureArray;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1067,6 +1136,7 @@ typedef struct rlglData {
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
+        float texlayer;                     // Current active texture array layer (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
 
@@ -1088,6 +1158,10 @@ typedef struct rlglData {
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        char shaderCachePath[RL_MAX_SHADER_CACHE_PATH_LENGTH]; // Shader program binary cache directory (empty: cache disabled)
+        rlShaderUniforms **shaderUniforms;  // Shader programs uniforms tables, indexed by program id
+        unsigned int shaderUniformsCount;   // Shader programs uniforms tables array size
+        rlShaderUniforms *currentUniforms;  // Current enabled shader program uniforms table (NULL if not available)
 
         bool stereoRender;                  // Stereo rendering flag
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
@@ -1110,6 +1184,14 @@ typedef struct rlglData {
         int framebufferHeight;              // Current framebuffer height
 
     } State;            // Renderer state
+    struct {
+        unsigned int shaderId;              // Texture array shader program id, default shader sampling texture0 as sampler2DArray
+        int mvpLoc;                         // Texture array shader location: model-view-projection matrix
+        rlBatchTextureArray arrays[RL_MAX_BATCH_TEXTURE_ARRAYS]; // Batch texture arrays
+        int arrayCount;                     // Batch texture arrays count
+        unsigned int *textureLayers;        // Texture array and layer by texture id: ((arrayIndex + 1) << 16) | layer (0: not in an array)
+        unsigned int textureLayersCount;    // Texture array and layer table size
+    } TextureArrays;    // Batch texture arrays
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -1127,6 +1209,8 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool programBinary;                 // Program binary retrieval support, at least one binary format (GL_ARB_get_program_binary)
+        bool parallelShaderCompile;         // Shader compile and link completion status query support (GL_KHR_parallel_shader_compile, GL_ARB_parallel_shader_compile)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1147,6 +1231,23 @@ static rlglData RLGL = { 0 };
 #endif // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 static bool isGpuReady = false;
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// NOTE: Parallel shader compilation functionality is exposed through extensions (KHR/ARB), loaded on rlLoadExtensions()
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+// NOTE: Calling convention depends on the loader: glad headers (OpenGL 3.3, desktop OpenGL ES 2.0) or native GLES headers
+#if defined(GLAD_API_PTR)
+typedef void (GLAD_API_PTR *rlglMaxShaderCompilerThreadsProc)(GLuint count);
+#else
+    #ifndef GL_APIENTRY
+        #define GL_APIENTRY
+    #endif
+typedef void (GL_APIENTRY *rlglMaxShaderCompilerThreadsProc)(GLuint count);
+#endif
+static rlglMaxShaderCompilerThreadsProc glMaxShaderCompilerThreadsRL = NULL;
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1165,9 +1266,25 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+static void rlLoadShaderTextureArray(void); // Load texture array shader, used for batch texture arrays draws
+static bool rlIsBatchTextureArray(unsigned int id); // Check if texture id is a batch texture array
+static unsigned int rlLoadBatchTextureArrayStorage(int width, int height, int format, int layers); // Load empty texture array for batch texture layers
+static bool rlGrowBatchTextureArray(rlBatchTextureArray *array, unsigned int fboId); // Double batch texture array layers, copying used layers
+#endif
 #if RLGL_SHOW_GL_DETAILS_INFO
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode); // Get shader program binary cache key from sources and driver strings
+static unsigned int rlLoadShaderProgramBinary(unsigned long long key);                   // Load shader program from binary cache (if available)
+static void rlSaveShaderProgramBinary(unsigned int id, unsigned long long key);          // Save shader program binary into cache
+#endif
+static void rlSetShaderProgramLinkParams(unsigned int programId);  // Set shader program default attribute locations and parameters (before linking)
+static void rlLoadShaderUniforms(unsigned int programId);          // Load shader program uniforms table (after linking)
+static void rlUnloadShaderUniforms(unsigned int programId);        // Unload shader program uniforms table
+static rlShaderUniforms *rlGetShaderUniforms(unsigned int programId); // Get shader program uniforms table (NULL if not available)
+static bool rlCheckUniformUpload(int locIndex, const void *value, int size, int mode); // Check if uniform value upload is required for current shader, updating shadow copy
 #endif
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
@@ -1574,6 +1691,11 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
 
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+    // Add current texture array layer
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texlayers[RLGL.State.vertexCounter] = RLGL.State.texlayer;
+#endif
+
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
 }
@@ -1673,6 +1795,17 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        // Textures copied into a batch texture array draw with the array, so a texture change
+        // within the same array only changes the vertex layer and does not start a new draw
+        // NOTE: Only the default shader is replaced by the texture array shader on batch drawing
+        if ((id < RLGL.TextureArrays.textureLayersCount) && (RLGL.TextureArrays.textureLayers[id] != 0) &&
+            (RLGL.State.currentShaderId == RLGL.State.defaultShaderId))
+        {
+            RLGL.State.texlayer = (float)(RLGL.TextureArrays.textureLayers[id] & 0xffff);
+            id = RLGL.TextureArrays.arrays[(RLGL.TextureArrays.textureLayers[id] >> 16) - 1].id;
+        }
+#endif
         RLGL.State.currentTextureId = id;
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
@@ -1842,6 +1975,7 @@ void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+    RLGL.State.currentUniforms = rlGetShaderUniforms(id);
 #endif
 }
 
@@ -1850,6 +1984,7 @@ void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(0);
+    RLGL.State.currentUniforms = NULL;
 #endif
 }
 
@@ -2377,10 +2512,17 @@ void rlglInit(int width, int height)
 void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlUnloadBatchTextureArrays();
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
     rlUnloadShaderDefault(); // Unload default shader
 
+    // Unload remaining shader programs uniforms tables
+    for (unsigned int i = 0; i < RLGL.State.shaderUniformsCount; i++) rlUnloadShaderUniforms(i);
+    RL_FREE(RLGL.State.shaderUniforms);
+    RLGL.State.shaderUniforms = NULL;
+    RLGL.State.shaderUniformsCount = 0;
+
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
@@ -2412,6 +2554,20 @@ void rlLoadExtensions(void *loader)
     for (int i = 0; i < numExt; i++) TRACELOG(RL_LOG_INFO, "    %s", glGetStringi(GL_EXTENSIONS, i));
 #endif
 
+#if !defined(GRAPHICS_API_OPENGL_21)
+    // Check parallel shader compilation support
+    // NOTE: Extension is not included in glad generated loader, it must be checked manually
+    for (int i = 0; i < numExt; i++)
+    {
+        const char *extension = (const char *)glGetStringi(GL_EXTENSIONS, i);
+
+        if (strcmp(extension, "GL_KHR_parallel_shader_compile") == 0) glMaxShaderCompilerThreadsRL = (rlglMaxShaderCompilerThreadsProc)((rlglLoadProc)loader)("glMaxShaderCompilerThreadsKHR");
+        else if (strcmp(extension, "GL_ARB_parallel_shader_compile") == 0) glMaxShaderCompilerThreadsRL = (rlglMaxShaderCompilerThreadsProc)((rlglLoadProc)loader)("glMaxShaderCompilerThreadsARB");
+
+        if (glMaxShaderCompilerThreadsRL != NULL) { RLGL.ExtSupported.parallelShaderCompile = true; break; }
+    }
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_21)
     // Register supported extensions flags
     // Optional OpenGL 2.1 extensions
@@ -2446,6 +2602,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    RLGL.ExtSupported.programBinary = GLAD_GL_ARB_get_program_binary || GLAD_GL_VERSION_4_1;
 
 #endif // GRAPHICS_API_OPENGL_33
 
@@ -2471,6 +2628,7 @@ void rlLoadExtensions(void *loader)
     //RLGL.ExtSupported.maxAnisotropyLevel = true;
     //RLGL.ExtSupported.computeShader = true;
     //RLGL.ExtSupported.ssbo = true;
+    RLGL.ExtSupported.programBinary = true;
 
 #elif defined(GRAPHICS_API_OPENGL_ES2)
 
@@ -2608,6 +2766,13 @@ void rlLoadExtensions(void *loader)
 
         // Check clamp mirror wrap mode support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
+
+        // Check parallel shader compilation support
+        if (strcmp(extList[i], (const char *)"GL_KHR_parallel_shader_compile") == 0)
+        {
+            glMaxShaderCompilerThreadsRL = (rlglMaxShaderCompilerThreadsProc)((rlglLoadProc)loader)("glMaxShaderCompilerThreadsKHR");
+            if (glMaxShaderCompilerThreadsRL != NULL) RLGL.ExtSupported.parallelShaderCompile = true;
+        }
     }
 
     // Free extensions pointers
@@ -2633,6 +2798,19 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // Let the driver choose the number of shader compiler threads
+    if (RLGL.ExtSupported.parallelShaderCompile) glMaxShaderCompilerThreadsRL(0xffffffff);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // NOTE: Program binaries can only be retrieved if driver exposes at least one binary format
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+        RLGL.ExtSupported.programBinary = (binaryFormatCount > 0);
+    }
+#endif
+
 #if RLGL_SHOW_GL_DETAILS_INFO
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2809,6 +2987,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));    // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));      // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        batch.vertexBuffer[i].texlayers = (float *)RL_CALLOC(bufferElements*4, sizeof(float));      // 1 float by vertex, 4 vertex by quad
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_CALLOC(bufferElements*6, sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2820,6 +3001,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        for (int j = 0; j < (4*bufferElements); j++) batch.vertexBuffer[i].texlayers[j] = 0.0f;
+#endif
 
         int k = 0;
 
@@ -2882,6 +3066,16 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        // Vertex texture array layer buffer (shader-location = 13)
+        // NOTE: Only read by the texture array shader, uploaded only for batches with texture array draws
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[5]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[5]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(float), batch.vertexBuffer[i].texlayers, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER, 1, GL_FLOAT, 0, 0, 0);
+#endif
+
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
@@ -2943,6 +3137,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER);
+#endif
             glBindVertexArray(0);
         }
 
@@ -2952,6 +3149,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[5]);
+#endif
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
@@ -2961,6 +3161,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].normals);
         RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].texlayers);
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -3006,6 +3207,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
 
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+        // Texture array layers buffer, only required if some draw uses a batch texture array
+        for (int i = 0; i < batch->drawCounter; i++)
+        {
+            if (rlIsBatchTextureArray(batch->draws[i].textureId))
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[5]);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texlayers);
+                break;
+            }
+        }
+#endif
+
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
         // To avoid waiting (idle), glBufferData() can bee called first with NULL pointer before glMapBuffer()
@@ -3050,15 +3264,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlEnableShader(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], matMVP);
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], RLGL.State.projection);
             }
 
             // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
@@ -3066,17 +3280,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], RLGL.State.modelview);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], RLGL.State.transform);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform)));
             }
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
@@ -3106,8 +3320,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            float colorDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int mapDiffuse = 0;     // Active default sampler2D: texture0
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colorDiffuse, RL_SHADER_UNIFORM_VEC4, 1);
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &mapDiffuse, RL_SHADER_UNIFORM_SAMPLER2D, 1);
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -3124,8 +3340,29 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+            bool textureArrayShader = false;    // Texture array shader enabled instead of current shader
+#endif
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+                // Batch texture arrays draws use the texture array shader, the rest use current shader
+                // NOTE: Uniforms are kept by each program, switching programs does not require uploading them again
+                bool textureArray = rlIsBatchTextureArray(batch->draws[i].textureId);
+                if (textureArray != textureArrayShader)
+                {
+                    if (textureArray)
+                    {
+                        glUseProgram(RLGL.TextureArrays.shaderId);
+                        glUniformMatrix4fv(RLGL.TextureArrays.mvpLoc, 1, false, rlMatrixToFloatV(matMVP).v);
+                    }
+                    else glUseProgram(RLGL.State.currentShaderId);
+                    textureArrayShader = textureArray;
+                }
+
+                if (textureArray) glBindTexture(GL_TEXTURE_2D_ARRAY, batch->draws[i].textureId);
+                else
+#endif
                 // Bind current draw call texture, activated as GL_TEXTURE0 and bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
@@ -3153,11 +3390,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+            if (RLGL.TextureArrays.arrayCount > 0) glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+#endif
         }
 
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlDisableShader();  // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -3665,9 +3905,150 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 // Unload texture from GPU memory
 void rlUnloadTexture(unsigned int id)
 {
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+    // NOTE: Texture array layer is not reused, it is released with rlUnloadBatchTextureArrays()
+    if (id < RLGL.TextureArrays.textureLayersCount) RLGL.TextureArrays.textureLayers[id] = 0;
+#endif
     glDeleteTextures(1, &id);
 }
 
+// Copy texture into a layer of a batch texture array, shared with textures of same size and format
+// NOTE: Draws using the texture with the default shader are batched with draws using any other texture of
+// the same array, the layer is provided by vertex and the array is sampled by the texture array shader.
+// Layer is a copy of texture base level at the moment of the call: later texture updates are not reflected,
+// mipmaps are not used and sampling uses nearest filter and repeat wrap
+bool rlLoadBatchTextureLayer(unsigned int id, int width, int height, int format)
+{
+    bool result = false;
+
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+    if ((id == 0) || (id >= 65536) || (width <= 0) || (height <= 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Texture can not be copied into a batch texture array", id);
+        return result;
+    }
+
+    if ((id < RLGL.TextureArrays.textureLayersCount) && (RLGL.TextureArrays.textureLayers[id] != 0)) return true;
+
+    if (RLGL.TextureArrays.shaderId == 0)
+    {
+        rlLoadShaderTextureArray();
+        if (RLGL.TextureArrays.shaderId == 0) return result;
+    }
+
+    // Texture array and layer table is directly indexed by texture id
+    if (id >= RLGL.TextureArrays.textureLayersCount)
+    {
+        unsigned int count = (RLGL.TextureArrays.textureLayersCount > 0)? RLGL.TextureArrays.textureLayersCount : 64;
+        while (count <= id) count *= 2;
+
+        unsigned int *textureLayers = (unsigned int *)RL_CALLOC(count, sizeof(unsigned int));
+        if (textureLayers == NULL) return result;
+
+        if (RLGL.TextureArrays.textureLayers != NULL) memcpy(textureLayers, RLGL.TextureArrays.textureLayers, RLGL.TextureArrays.textureLayersCount*sizeof(unsigned int));
+        RL_FREE(RLGL.TextureArrays.textureLayers);
+        RLGL.TextureArrays.textureLayers = textureLayers;
+        RLGL.TextureArrays.textureLayersCount = count;
+    }
+
+    // Find an array with same size and format and free layers, or create a new one
+    int index = -1;
+    for (int i = 0; i < RLGL.TextureArrays.arrayCount; i++)
+    {
+        rlBatchTextureArray *array = &RLGL.TextureArrays.arrays[i];
+        if ((array->width == width) && (array->height == height) && (array->format == format) &&
+            (array->layerCount < RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS)) { index = i; break; }
+    }
+
+    if (index == -1)
+    {
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        if ((RLGL.TextureArrays.arrayCount >= RL_MAX_BATCH_TEXTURE_ARRAYS) || (glInternalFormat == 0))
+        {
+            TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] No batch texture array available for texture", id);
+            return result;
+        }
+
+        // NOTE: Arrays start with a few layers and grow on demand, layers of big textures are expensive
+        int layers = (RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS < 4)? RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS : 4;
+        rlBatchTextureArray *array = &RLGL.TextureArrays.arrays[RLGL.TextureArrays.arrayCount];
+        array->id = rlLoadBatchTextureArrayStorage(width, height, format, layers);
+
+        if (array->id == 0) return result;
+
+        array->width = width;
+        array->height = height;
+        array->format = format;
+        array->layerCount = 0;
+        array->layerCapacity = layers;
+        index = RLGL.TextureArrays.arrayCount++;
+
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Batch texture array loaded successfully (%i x %i x %i)", array->id, width, height, layers);
+    }
+
+    // Copy texture base level into next array layer, reading it through a temporary framebuffer
+    rlBatchTextureArray *array = &RLGL.TextureArrays.arrays[index];
+    GLint readFramebufferId = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebufferId);
+
+    unsigned int fboId = 0;
+    glGenFramebuffers(1, &fboId);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+    if (glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Texture format can not be copied into a batch texture array", id);
+    else if ((array->layerCount == array->layerCapacity) && !rlGrowBatchTextureArray(array, fboId)) TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Batch texture array could not be grown", id);
+    else
+    {
+        // NOTE: Growing the array attaches its layers to the framebuffer, attach the texture again
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array->id);
+        glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, array->layerCount, 0, 0, width, height);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+        RLGL.TextureArrays.textureLayers[id] = ((index + 1) << 16) | array->layerCount;
+        array->layerCount++;
+        result = true;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebufferId);
+    glDeleteFramebuffers(1, &fboId);
+#endif
+
+    return result;
+}
+
+// Unload batch texture arrays and texture array shader
+// NOTE: Textures copied into the arrays are drawn on their own again
+void rlUnloadBatchTextureArrays(void)
+{
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+    // Pending draws could be using the arrays
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    for (int i = 0; i < RLGL.TextureArrays.arrayCount; i++)
+    {
+        if (RLGL.State.currentTextureId == RLGL.TextureArrays.arrays[i].id) RLGL.State.currentTextureId = RLGL.State.defaultTextureId;
+        glDeleteTextures(1, &RLGL.TextureArrays.arrays[i].id);
+        RLGL.TextureArrays.arrays[i].id = 0;
+    }
+    RLGL.TextureArrays.arrayCount = 0;
+
+    RL_FREE(RLGL.TextureArrays.textureLayers);
+    RLGL.TextureArrays.textureLayers = NULL;
+    RLGL.TextureArrays.textureLayersCount = 0;
+
+    if (RLGL.TextureArrays.shaderId != 0)
+    {
+        rlUnloadShaderProgram(RLGL.TextureArrays.shaderId);
+        RLGL.TextureArrays.shaderId = 0;
+    }
+#endif
+}
+
 // Generate mipmap data for selected texture
 // NOTE: Only supports GPU mipmap generation
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
@@ -4186,6 +4567,19 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before InitWindow()?"); return id; }
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Try loading shader program from binary cache (if enabled), skipping compilation
+    unsigned long long cacheKey = 0;
+    bool useShaderCache = (RLGL.State.shaderCachePath[0] != '\0') && RLGL.ExtSupported.programBinary && ((vsCode != NULL) || (fsCode != NULL));
+
+    if (useShaderCache)
+    {
+        cacheKey = rlGetShaderCacheKey(vsCode, fsCode);
+        id = rlLoadShaderProgramBinary(cacheKey);
+        if (id > 0) return id;
+    }
+#endif
+
     unsigned int vertexShaderId = 0;
     unsigned int fragmentShaderId = 0;
 
@@ -4228,6 +4622,9 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
             TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
             id = RLGL.State.defaultShaderId;
         }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+        else if (useShaderCache) rlSaveShaderProgramBinary(id, cacheKey);
+#endif
         /*
         else
         {
@@ -4336,17 +4733,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glAttachShader(programId, fShaderId);
 
     // Default attribute shader locations must be bound before linking
-    // NOTE: There is no problem with binding a generic attribute index to an attribute variable name
-    // that is never used; if some attrib name is no found on the shader, it locations becomes -1
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCETRANSFORM, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEINDICES, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEINDICES);
-    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    rlSetShaderProgramLinkParams(programId);
 
     glLinkProgram(programId);
 
@@ -4381,6 +4768,8 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
         //GLint binarySize = 0;
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
+        rlLoadShaderUniforms(programId);
+
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", programId);
     }
 #endif
@@ -4391,19 +4780,323 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlUnloadShaderUniforms(id);
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
 }
 
+// Reload shader program from code strings, keeps program id
+// NOTE: New code is linked into a temporary program first, a failed link
+// on the original program would leave it unusable
+bool rlReloadShaderCode(unsigned int id, const char *vsCode, const char *fsCode)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (id == RLGL.State.defaultShaderId))
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Default or invalid shader program can not be reloaded", id);
+        return result;
+    }
+
+    unsigned int vertexShaderId = (vsCode != NULL)? rlCompileShader(vsCode, GL_VERTEX_SHADER) : RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = (fsCode != NULL)? rlCompileShader(fsCode, GL_FRAGMENT_SHADER) : RLGL.State.defaultFShaderId;
+
+    if ((vertexShaderId > 0) && (fragmentShaderId > 0))
+    {
+        unsigned int testId = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        if (testId > 0)
+        {
+            glDetachShader(testId, vertexShaderId);
+            glDetachShader(testId, fragmentShaderId);
+            rlUnloadShaderProgram(testId);
+
+            // Replace attached shaders and relink, program id is kept
+            GLuint attachedIds[8] = { 0 };
+            GLsizei attachedCount = 0;
+            glGetAttachedShaders(id, 8, &attachedCount, attachedIds);
+            for (int i = 0; i < attachedCount; i++) glDetachShader(id, attachedIds[i]);
+
+            glAttachShader(id, vertexShaderId);
+            glAttachShader(id, fragmentShaderId);
+            rlSetShaderProgramLinkParams(id);
+            glLinkProgram(id);
+            glDetachShader(id, vertexShaderId);
+            glDetachShader(id, fragmentShaderId);
+
+            GLint success = 0;
+            glGetProgramiv(id, GL_LINK_STATUS, &success);
+
+            if (success != GL_FALSE)
+            {
+                // Uniform locations and values changed with the relink (values are reset to 0)
+                bool current = (RLGL.State.currentUniforms != NULL) && (RLGL.State.currentUniforms == rlGetShaderUniforms(id));
+                rlUnloadShaderUniforms(id);
+                rlLoadShaderUniforms(id);
+                if (current) RLGL.State.currentUniforms = rlGetShaderUniforms(id);
+
+                TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader reloaded successfully", id);
+                result = true;
+            }
+            else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to relink shader program", id);
+        }
+    }
+
+    if ((vertexShaderId > 0) && (vertexShaderId != RLGL.State.defaultVShaderId)) glDeleteShader(vertexShaderId);
+    if ((fragmentShaderId > 0) && (fragmentShaderId != RLGL.State.defaultFShaderId)) glDeleteShader(fragmentShaderId);
+
+    if (!result) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to reload shader program, previous program kept", id);
+#endif
+
+    return result;
+}
+
+// Load multiple shaders from code strings
+// NOTE: All compiles and links are submitted first without querying their status, so the driver
+// can process them in parallel (GL_KHR_parallel_shader_compile). Returned programs are pending,
+// use rlIsShaderProgramReady() to poll completion and rlFinishShaderProgram() before using them
+void rlLoadShaderCodeBatch(const char **vsCodes, const char **fsCodes, int count, unsigned int *ids)
+{
+    for (int i = 0; i < count; i++) ids[i] = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before InitWindow()?"); return; }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Shader objects pending linkage, two per program: vertex and fragment shader
+    unsigned int *shaderIds = (unsigned int *)RL_CALLOC(2*count, sizeof(unsigned int));
+    if (shaderIds == NULL) return;
+
+    // Submit all shaders compilation
+    for (int i = 0; i < count; i++)
+    {
+        const char *vsCode = (vsCodes != NULL)? vsCodes[i] : NULL;
+        const char *fsCode = (fsCodes != NULL)? fsCodes[i] : NULL;
+
+        // In case vertex and fragment shader are the default ones, assign the default shader program id
+        if ((vsCode == NULL) && (fsCode == NULL)) { ids[i] = RLGL.State.defaultShaderId; continue; }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+        // Try loading shader program from binary cache (if enabled), skipping compilation
+        if ((RLGL.State.shaderCachePath[0] != '\0') && RLGL.ExtSupported.programBinary)
+        {
+            ids[i] = rlLoadShaderProgramBinary(rlGetShaderCacheKey(vsCode, fsCode));
+            if (ids[i] > 0) continue;
+        }
+#endif
+        for (int k = 0; k < 2; k++)
+        {
+            const char *code = (k == 0)? vsCode : fsCode;
+
+            if (code != NULL)
+            {
+                shaderIds[2*i + k] = glCreateShader((k == 0)? GL_VERTEX_SHADER : GL_FRAGMENT_SHADER);
+                glShaderSource(shaderIds[2*i + k], 1, &code, NULL);
+                glCompileShader(shaderIds[2*i + k]);
+            }
+            else shaderIds[2*i + k] = (k == 0)? RLGL.State.defaultVShaderId : RLGL.State.defaultFShaderId;
+        }
+    }
+
+    // Submit all shader programs linkage
+    for (int i = 0; i < count; i++)
+    {
+        if ((shaderIds[2*i] == 0) || (shaderIds[2*i + 1] == 0)) continue;
+
+        ids[i] = glCreateProgram();
+        glAttachShader(ids[i], shaderIds[2*i]);
+        glAttachShader(ids[i], shaderIds[2*i + 1]);
+        rlSetShaderProgramLinkParams(ids[i]);
+        glLinkProgram(ids[i]);
+
+        // Flag shaders for deletion (if not default ones), they are released once detached from program
+        // NOTE: Shaders remain valid while attached, required to report compile errors on rlFinishShaderProgram()
+        if (shaderIds[2*i] != RLGL.State.defaultVShaderId) glDeleteShader(shaderIds[2*i]);
+        if (shaderIds[2*i + 1] != RLGL.State.defaultFShaderId) glDeleteShader(shaderIds[2*i + 1]);
+    }
+
+    RL_FREE(shaderIds);
+#endif
+}
+
+// Check if shader program compile and link completed
+// NOTE: Without GL_KHR_parallel_shader_compile support programs are always reported as ready,
+// completion is then waited for on rlFinishShaderProgram()
+bool rlIsShaderProgramReady(unsigned int id)
+{
+    bool ready = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.parallelShaderCompile && (id > 0) && (id != RLGL.State.defaultShaderId))
+    {
+        GLint completed = GL_TRUE;
+        glGetProgramiv(id, GL_COMPLETION_STATUS_KHR, &completed);
+        ready = (completed == GL_TRUE);
+    }
+#endif
+
+    return ready;
+}
+
+// Finish shader program loading, checking compile and link errors
+// NOTE: Blocks until program linkage completes, in case of failure program is unloaded and default shader id returned
+unsigned int rlFinishShaderProgram(unsigned int id)
+{
+    unsigned int programId = id;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (id == RLGL.State.defaultShaderId)) return RLGL.State.defaultShaderId;
+
+    GLint success = 0;
+    glGetProgramiv(id, GL_LINK_STATUS, &success);
+
+    // Shaders remain attached until program is finished (not attached if loaded from binary cache)
+    GLuint shaderIds[2] = { 0 };
+    GLsizei shaderCount = 0;
+    glGetAttachedShaders(id, 2, &shaderCount, shaderIds);
+
+    if (success == GL_FALSE)
+    {
+        for (int i = 0; i < shaderCount; i++)
+        {
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shaderIds[i], GL_COMPILE_STATUS, &compiled);
+
+            if (compiled == GL_FALSE)
+            {
+                int maxLength = 0;
+                glGetShaderiv(shaderIds[i], GL_INFO_LOG_LENGTH, &maxLength);
+
+                if (maxLength > 0)
+                {
+                    int length = 0;
+                    char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+                    glGetShaderInfoLog(shaderIds[i], maxLength, &length, log);
+                    TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shaderIds[i], log);
+                    RL_FREE(log);
+                }
+            }
+        }
+
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", id);
+
+        int maxLength = 0;
+        glGetProgramiv(id, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(id, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", id, log);
+            RL_FREE(log);
+        }
+
+        // NOTE: Attached shaders flagged for deletion are released with the program
+        glDeleteProgram(id);
+
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+        programId = RLGL.State.defaultShaderId;
+    }
+    else if (shaderCount > 0)
+    {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+        // Save program binary into cache (if enabled), cache key requires the original shaders code
+        if ((RLGL.State.shaderCachePath[0] != '\0') && RLGL.ExtSupported.programBinary)
+        {
+            char *codes[2] = { NULL, NULL };    // Vertex and fragment shaders code, NULL for default ones
+
+            for (int i = 0; i < shaderCount; i++)
+            {
+                if ((shaderIds[i] == RLGL.State.defaultVShaderId) || (shaderIds[i] == RLGL.State.defaultFShaderId)) continue;
+
+                GLint type = 0;
+                GLint codeLength = 0;
+                glGetShaderiv(shaderIds[i], GL_SHADER_TYPE, &type);
+                glGetShaderiv(shaderIds[i], GL_SHADER_SOURCE_LENGTH, &codeLength);
+
+                char *code = (char *)RL_CALLOC(codeLength + 1, sizeof(char));
+                glGetShaderSource(shaderIds[i], codeLength + 1, NULL, code);
+                codes[(type == GL_VERTEX_SHADER)? 0 : 1] = code;
+            }
+
+            rlSaveShaderProgramBinary(id, rlGetShaderCacheKey(codes[0], codes[1]));
+
+            RL_FREE(codes[0]);
+            RL_FREE(codes[1]);
+        }
+#endif
+        // Detaching shaders from program, releasing them (if not default ones)
+        for (int i = 0; i < shaderCount; i++) glDetachShader(id, shaderIds[i]);
+
+        rlLoadShaderUniforms(id);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", id);
+    }
+#endif
+
+    return programId;
+}
+
+// Set shader program binary cache directory
+// NOTE: Cache is disabled by default, directory must exist, binaries are only valid for same driver
+void rlSetShaderCacheDirectory(const char *path)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.shaderCachePath[0] = '\0';
+
+    if (path != NULL)
+    {
+        int length = (int)strlen(path);
+
+        // NOTE: Cache file name appends 22 characters to the directory: "/" + 16 hex digits + ".rlsb"
+        if (length >= RL_MAX_SHADER_CACHE_PATH_LENGTH - 22) TRACELOG(RL_LOG_WARNING, "SHADER: Cache directory path too long, cache disabled");
+        else
+        {
+            memcpy(RLGL.State.shaderCachePath, path, length + 1);
+
+            // Remove trailing path separator, it is added on cache file path composition
+            if ((length > 0) && ((path[length - 1] == '/') || (path[length - 1] == '\\'))) RLGL.State.shaderCachePath[length - 1] = '\0';
+        }
+    }
+#endif
+}
+
 // Get shader location uniform
 // NOTE: First parameter refers to shader program id
 int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
 {
     int location = -1;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(shaderId);
+
+    if ((uniforms != NULL) && (uniformName != NULL))
+    {
+        // Look for uniform name in program uniforms table
+        unsigned int hash = 2166136261u;
+        for (const unsigned char *c = (const unsigned char *)uniformName; *c != '\0'; c++) hash = (hash ^ *c)*16777619u;
+
+        bool found = false;
+        for (int i = hash & (uniforms->slotCount - 1); uniforms->slots[i] >= 0; i = (i + 1) & (uniforms->slotCount - 1))
+        {
+            rlShaderUniform *uniform = &uniforms->uniforms[uniforms->slots[i]];
+            const char *name = uniforms->names + uniform->nameOffset;
+
+            if ((strcmp(name, uniformName) == 0) ||
+                ((uniform->nameBaseLength > 0) && (strncmp(name, uniformName, uniform->nameBaseLength) == 0) && (uniformName[uniform->nameBaseLength] == '\0')))
+            {
+                location = uniform->location;
+                found = true;
+                break;
+            }
+        }
+
+        // NOTE: Only array elements (i.e. "values[2]") are not registered in table,
+        // any other name not found is not an active uniform
+        if (!found && (strchr(uniformName, '[') != NULL)) location = glGetUniformLocation(shaderId, uniformName);
+    }
+    else location = glGetUniformLocation(shaderId, uniformName);
 
     //if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
     //else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
@@ -4429,6 +5122,19 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Skip upload if value is not changed since last upload
+    int size = 0;
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: case RL_SHADER_UNIFORM_INT: case RL_SHADER_UNIFORM_UINT: case RL_SHADER_UNIFORM_SAMPLER2D: size = 4; break;
+        case RL_SHADER_UNIFORM_VEC2: case RL_SHADER_UNIFORM_IVEC2: case RL_SHADER_UNIFORM_UIVEC2: size = 8; break;
+        case RL_SHADER_UNIFORM_VEC3: case RL_SHADER_UNIFORM_IVEC3: case RL_SHADER_UNIFORM_UIVEC3: size = 12; break;
+        case RL_SHADER_UNIFORM_VEC4: case RL_SHADER_UNIFORM_IVEC4: case RL_SHADER_UNIFORM_UIVEC4: size = 16; break;
+        default: break;
+    }
+
+    if ((size > 0) && !rlCheckUniformUpload(locIndex, value, size*count, 0)) return;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4470,7 +5176,8 @@ void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType
 void rlSetUniformMatrix(int locIndex, Matrix mat)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUniformMatrix4fv(locIndex, 1, false, rlMatrixToFloat(mat));
+    rl_float16 matrix = rlMatrixToFloatV(mat);
+    if (rlCheckUniformUpload(locIndex, matrix.v, sizeof(matrix.v), 0)) glUniformMatrix4fv(locIndex, 1, false, matrix.v);
 #endif
 }
 
@@ -4478,11 +5185,11 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
 void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33)
-    glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
+    if (rlCheckUniformUpload(locIndex, matrices, count*sizeof(Matrix), 1)) glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
 #elif defined(GRAPHICS_API_OPENGL_ES2)
     // WARNING: WebGL does not support Matrix transpose ("true" parameter)
     // REF: https://developer.mozilla.org/en-US/docs/Web/API/WebGLRenderingContext/uniformMatrix
-    glUniformMatrix4fv(locIndex, count, false, (const float *)matrices);
+    if (rlCheckUniformUpload(locIndex, matrices, count*sizeof(Matrix), 1)) glUniformMatrix4fv(locIndex, count, false, (const float *)matrices);
 #endif
 }
 
@@ -4495,7 +5202,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == textureId)
         {
-            glUniform1i(locIndex, 1 + i);
+            int slot = 1 + i;
+            if (rlCheckUniformUpload(locIndex, &slot, sizeof(int), 0)) glUniform1i(locIndex, slot);
             return;
         }
     }
@@ -4506,7 +5214,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int slot = 1 + i;
+            if (rlCheckUniformUpload(locIndex, &slot, sizeof(int), 0)) glUniform1i(locIndex, slot); // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -5104,6 +5813,7 @@ static void rlUnloadShaderDefault(void)
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
 
+    rlUnloadShaderUniforms(RLGL.State.defaultShaderId);
     glDeleteProgram(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
@@ -5111,6 +5821,499 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+#if defined(RLGL_BATCH_TEXTURE_ARRAYS)
+// Load texture array shader
+// NOTE: Same as default shader but texture0 is a sampler2DArray, sampled at vertex texture array layer
+static void rlLoadShaderTextureArray(void)
+{
+    const char *vShaderCode =
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+#else
+    "#version 330                       \n"
+#endif
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexLayer;           \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "flat out float fragTexLayer;       \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexLayer = vertexTexLayer; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *fShaderCode =
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "precision mediump sampler2DArray;  \n"     // No default precision for sampler2DArray on OpenGL ES3
+#else
+    "#version 330                       \n"
+#endif
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "flat in float fragTexLayer;        \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2DArray texture0;   \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, vec3(fragTexCoord, fragTexLayer)); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+
+    unsigned int vShaderId = rlCompileShader(vShaderCode, GL_VERTEX_SHADER);
+    unsigned int fShaderId = rlCompileShader(fShaderCode, GL_FRAGMENT_SHADER);
+
+    if ((vShaderId != 0) && (fShaderId != 0)) RLGL.TextureArrays.shaderId = rlLoadShaderProgram(vShaderId, fShaderId);
+
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (RLGL.TextureArrays.shaderId > 0)
+    {
+        // Constant uniforms are set once, mvp is uploaded on batch drawing
+        RLGL.TextureArrays.mvpLoc = glGetUniformLocation(RLGL.TextureArrays.shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+
+        glUseProgram(RLGL.TextureArrays.shaderId);
+        glUniform4f(glGetUniformLocation(RLGL.TextureArrays.shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR), 1.0f, 1.0f, 1.0f, 1.0f);
+        glUniform1i(glGetUniformLocation(RLGL.TextureArrays.shaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0), 0);
+        glUseProgram(0);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Texture array shader loaded successfully", RLGL.TextureArrays.shaderId);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load texture array shader");
+}
+
+// Check if texture id is a batch texture array
+static bool rlIsBatchTextureArray(unsigned int id)
+{
+    for (int i = 0; i < RLGL.TextureArrays.arrayCount; i++)
+    {
+        if (RLGL.TextureArrays.arrays[i].id == id) return true;
+    }
+
+    return false;
+}
+
+// Load empty texture array for batch texture layers, sampled with nearest filter and repeat wrap
+static unsigned int rlLoadBatchTextureArrayStorage(int width, int height, int format, int layers)
+{
+    unsigned int id = 0;
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, glInternalFormat, width, height, layers, 0, glFormat, glType, NULL);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_ES3)
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+    else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+        glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+#endif
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    return id;
+}
+
+// Double batch texture array layers (up to RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS), copying used layers
+// into a new texture array through the provided read framebuffer
+// NOTE: Pending draws reference the array id, so current batch is drawn before replacing it
+static bool rlGrowBatchTextureArray(rlBatchTextureArray *array, unsigned int fboId)
+{
+    if (array->layerCapacity >= RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS) return false;
+
+    int layers = ((array->layerCapacity*2) < RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS)? array->layerCapacity*2 : RL_DEFAULT_BATCH_TEXTURE_ARRAY_LAYERS;
+    unsigned int id = rlLoadBatchTextureArrayStorage(array->width, array->height, array->format, layers);
+    if (id == 0) return false;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    for (int i = 0; i < array->layerCount; i++)
+    {
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, array->id, 0, i);
+        glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, 0, 0, array->width, array->height);
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+
+    if (RLGL.State.currentTextureId == array->id) RLGL.State.currentTextureId = id;
+    glDeleteTextures(1, &array->id);
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Batch texture array grown (%i x %i x %i)", id, array->width, array->height, layers);
+
+    array->id = id;
+    array->layerCapacity = layers;
+
+    return true;
+}
+#endif
+
+// Set shader program default attribute locations and parameters (before linking)
+// NOTE: There is no problem with binding a generic attribute index to an attribute variable name
+// that is never used; if some attrib name is no found on the shader, it locations becomes -1
+static void rlSetShaderProgramLinkParams(unsigned int programId)
+{
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCETRANSFORM, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCETRANSFORM);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEINDICES, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEINDICES);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXLAYER, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXLAYER);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Program binary must be requested before linking, required by some drivers to retrieve it
+    if ((RLGL.State.shaderCachePath[0] != '\0') && RLGL.ExtSupported.programBinary) glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+}
+
+// Load shader program uniforms table (after linking)
+// NOTE: Table is used for hashed rlGetLocationUniform() queries and to skip redundant uniform uploads,
+// uniforms set with direct OpenGL calls (glUseProgram(), glUniform*()) bypass it, use rlEnableShader()
+static void rlLoadShaderUniforms(unsigned int programId)
+{
+    // NOTE: Program ids are expected to be small, tables are directly indexed by id
+    if ((programId == 0) || (programId >= 65536)) return;
+
+    rlUnloadShaderUniforms(programId);
+
+    if (programId >= RLGL.State.shaderUniformsCount)
+    {
+        unsigned int count = (RLGL.State.shaderUniformsCount > 0)? RLGL.State.shaderUniformsCount : 64;
+        while (count <= programId) count *= 2;
+
+        rlShaderUniforms **tables = (rlShaderUniforms **)RL_CALLOC(count, sizeof(rlShaderUniforms *));
+        if (tables == NULL) return;
+
+        if (RLGL.State.shaderUniforms != NULL) memcpy(tables, RLGL.State.shaderUniforms, RLGL.State.shaderUniformsCount*sizeof(rlShaderUniforms *));
+        RL_FREE(RLGL.State.shaderUniforms);
+        RLGL.State.shaderUniforms = tables;
+        RLGL.State.shaderUniformsCount = count;
+    }
+
+    GLint uniformCount = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(programId, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(programId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    if (maxNameLength < 1) maxNameLength = 1;
+
+    rlShaderUniforms *table = (rlShaderUniforms *)RL_CALLOC(1, sizeof(rlShaderUniforms));
+    table->uniformCount = uniformCount;
+    table->uniforms = (rlShaderUniform *)RL_CALLOC((uniformCount > 0)? uniformCount : 1, sizeof(rlShaderUniform));
+    table->names = (char *)RL_CALLOC((uniformCount > 0)? uniformCount*maxNameLength : 1, sizeof(char));
+
+    // Load uniforms name, location and value size
+    int namesSize = 0;
+    int valuesSize = 0;
+    int maxLocation = -1;
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        rlShaderUniform *uniform = &table->uniforms[i];
+        char *name = table->names + namesSize;
+        GLsizei nameLength = 0;
+        GLint arraySize = 0;
+        GLenum type = 0;
+
+        glGetActiveUniform(programId, i, maxNameLength, &nameLength, &arraySize, &type, name);
+        uniform->nameOffset = namesSize;
+        uniform->location = glGetUniformLocation(programId, name);
+        namesSize += nameLength + 1;
+
+        // Arrays are reported as "name[0]", they can also be queried as "name"
+        if ((nameLength > 3) && (strcmp(name + nameLength - 3, "[0]") == 0)) uniform->nameBaseLength = nameLength - 3;
+
+        int typeSize = 4;   // NOTE: Samplers and images are also set as 4 bytes integers
+        switch (type)
+        {
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_BOOL_VEC2: typeSize = 8; break;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_BOOL_VEC3: typeSize = 12; break;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_BOOL_VEC4: case GL_FLOAT_MAT2: typeSize = 16; break;
+            case GL_FLOAT_MAT3: typeSize = 36; break;
+            case GL_FLOAT_MAT4: typeSize = 64; break;
+        #if !defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3)
+            case GL_UNSIGNED_INT_VEC2: typeSize = 8; break;
+            case GL_UNSIGNED_INT_VEC3: typeSize = 12; break;
+            case GL_UNSIGNED_INT_VEC4: typeSize = 16; break;
+            case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2: typeSize = 24; break;
+            case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2: typeSize = 32; break;
+            case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3: typeSize = 48; break;
+        #endif
+            default: break;
+        }
+
+        // NOTE: Uniform block members have no location, they can not be set with glUniform*()
+        if (uniform->location >= 0)
+        {
+            uniform->valueOffset = valuesSize;
+            uniform->valueSize = typeSize*arraySize;
+            valuesSize += uniform->valueSize;
+            if (uniform->location > maxLocation) maxLocation = uniform->location;
+        }
+    }
+
+    table->values = (unsigned char *)RL_CALLOC((valuesSize > 0)? valuesSize : 1, sizeof(unsigned char));
+
+    // Load uniform indices by location
+    // NOTE: Only base locations are registered, array elements locations are not queried
+    table->locationCount = maxLocation + 1;
+    table->locationIndices = (int *)RL_MALLOC(((maxLocation >= 0)? maxLocation + 1 : 1)*sizeof(int));
+    for (int i = 0; i < table->locationCount; i++) table->locationIndices[i] = -1;
+    for (int i = 0; i < uniformCount; i++) if (table->uniforms[i].location >= 0) table->locationIndices[table->uniforms[i].location] = i;
+
+    // Load uniform names hash table, arrays are registered by both names ("name[0]" and "name")
+    table->slotCount = 16;
+    while (table->slotCount < uniformCount*4) table->slotCount *= 2;
+    table->slots = (int *)RL_MALLOC(table->slotCount*sizeof(int));
+    for (int i = 0; i < table->slotCount; i++) table->slots[i] = -1;
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        rlShaderUniform *uniform = &table->uniforms[i];
+        const unsigned char *name = (const unsigned char *)(table->names + uniform->nameOffset);
+
+        for (int k = 0; k < ((uniform->nameBaseLength > 0)? 2 : 1); k++)
+        {
+            unsigned int hash = 2166136261u;
+            for (int c = 0; (name[c] != '\0') && ((k == 0) || (c < uniform->nameBaseLength)); c++) hash = (hash ^ name[c])*16777619u;
+            if (k == 0) uniform->hash = hash;
+
+            int slot = hash & (table->slotCount - 1);
+            while (table->slots[slot] >= 0) slot = (slot + 1) & (table->slotCount - 1);
+            table->slots[slot] = i;
+        }
+    }
+
+    RLGL.State.shaderUniforms[programId] = table;
+}
+
+// Unload shader program uniforms table
+static void rlUnloadShaderUniforms(unsigned int programId)
+{
+    rlShaderUniforms *table = rlGetShaderUniforms(programId);
+
+    if (table != NULL)
+    {
+        if (RLGL.State.currentUniforms == table) RLGL.State.currentUniforms = NULL;
+
+        RL_FREE(table->uniforms);
+        RL_FREE(table->slots);
+        RL_FREE(table->locationIndices);
+        RL_FREE(table->names);
+        RL_FREE(table->values);
+        RL_FREE(table);
+
+        RLGL.State.shaderUniforms[programId] = NULL;
+    }
+}
+
+// Get shader program uniforms table (NULL if not available)
+static rlShaderUniforms *rlGetShaderUniforms(unsigned int programId)
+{
+    return (programId < RLGL.State.shaderUniformsCount)? RLGL.State.shaderUniforms[programId] : NULL;
+}
+
+// Check if uniform value upload is required for current shader, updating shadow copy
+// NOTE: Returns false if value (size in bytes) matches last value uploaded to that location
+static bool rlCheckUniformUpload(int locIndex, const void *value, int size, int mode)
+{
+    rlShaderUniforms *table = RLGL.State.currentUniforms;
+
+    if (locIndex < 0) return false;     // NOTE: Uploads to location -1 are silently ignored by OpenGL
+    if (table == NULL) return true;
+
+    int index = (locIndex < table->locationCount)? table->locationIndices[locIndex] : -1;
+
+    // Location is not an uniform base location (i.e. array element), it could overlap any uniform value
+    if (index < 0)
+    {
+        for (int i = 0; i < table->uniformCount; i++) table->uniforms[i].validSize = 0;
+        return true;
+    }
+
+    rlShaderUniform *uniform = &table->uniforms[index];
+    unsigned char *shadow = table->values + uniform->valueOffset;
+
+    if (size > uniform->valueSize)
+    {
+        uniform->validSize = 0;
+        return true;
+    }
+
+    if ((size <= uniform->validSize) && (mode == uniform->uploadMode) && (memcmp(shadow, value, size) == 0)) return false;
+
+    memcpy(shadow, value, size);
+    uniform->validSize = ((mode == uniform->uploadMode) && (uniform->validSize > size))? uniform->validSize : size;
+    uniform->uploadMode = mode;
+
+    return true;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+// Get shader program binary cache key from sources and driver strings
+// NOTE: Using FNV-1a 64bit hash, any driver update invalidates previous binaries
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode)
+{
+    const char *strings[7] = {
+        RLGL_VERSION,
+        (const char *)glGetString(GL_VENDOR),
+        (const char *)glGetString(GL_RENDERER),
+        (const char *)glGetString(GL_VERSION),
+        (const char *)glGetString(GL_SHADING_LANGUAGE_VERSION),
+        vsCode,
+        fsCode
+    };
+
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+
+    for (int i = 0; i < 7; i++)
+    {
+        // NOTE: NULL strings (default shaders) and string boundaries are also hashed
+        const unsigned char *str = (const unsigned char *)strings[i];
+        if (str != NULL) for (; *str != '\0'; str++) hash = (hash ^ *str)*0x100000001b3ULL;
+        hash = (hash ^ ((str != NULL)? 0xff : 0xfe))*0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Load shader program from binary cache (if available)
+// NOTE: Returns 0 if binary is not available or driver rejects it, shader must be compiled
+static unsigned int rlLoadShaderProgramBinary(unsigned long long key)
+{
+    unsigned int programId = 0;
+
+    char fileName[RL_MAX_SHADER_CACHE_PATH_LENGTH] = { 0 };
+    int fileNameLength = snprintf(fileName, RL_MAX_SHADER_CACHE_PATH_LENGTH, "%s/%016llx.rlsb", RLGL.State.shaderCachePath, key);
+    if ((fileNameLength < 0) || (fileNameLength >= RL_MAX_SHADER_CACHE_PATH_LENGTH))
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: Program binary cache file path too long, cache skipped");
+        return programId;
+    }
+
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) return programId;
+
+    // Cache file header: [4 bytes] "RLSB" id, [8 bytes] key, [4 bytes] binary format, [4 bytes] binary size
+    unsigned char header[20] = { 0 };
+    unsigned long long fileKey = 0;
+    unsigned int binaryFormat = 0;
+    int binarySize = 0;
+
+    if (fread(header, 1, 20, file) == 20)
+    {
+        memcpy(&fileKey, header + 4, 8);
+        memcpy(&binaryFormat, header + 12, 4);
+        memcpy(&binarySize, header + 16, 4);
+    }
+
+    if ((memcmp(header, "RLSB", 4) == 0) && (fileKey == key) && (binarySize > 0))
+    {
+        void *binary = RL_MALLOC(binarySize);
+
+        if ((binary != NULL) && (fread(binary, 1, binarySize, file) == (size_t)binarySize))
+        {
+            GLint success = 0;
+            programId = glCreateProgram();
+            glProgramBinary(programId, binaryFormat, binary, binarySize);
+            glGetProgramiv(programId, GL_LINK_STATUS, &success);
+
+            if (success == GL_FALSE)
+            {
+                TRACELOG(RL_LOG_INFO, "SHADER: [%016llx] Cached program binary rejected by driver, recompiling", key);
+                glDeleteProgram(programId);
+                programId = 0;
+            }
+            else
+            {
+                rlLoadShaderUniforms(programId);
+                TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from cache", programId);
+            }
+        }
+
+        RL_FREE(binary);
+    }
+
+    fclose(file);
+
+    return programId;
+}
+
+// Save shader program binary into cache
+static void rlSaveShaderProgramBinary(unsigned int id, unsigned long long key)
+{
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+    if (binarySize <= 0) return;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(20 + binarySize);
+    if (data == NULL) return;
+
+    GLenum binaryFormat = 0;
+    GLsizei length = 0;
+    glGetProgramBinary(id, binarySize, &length, &binaryFormat, data + 20);
+
+    if (length > 0)
+    {
+        unsigned int format = binaryFormat;
+        int size = length;
+        memcpy(data, "RLSB", 4);
+        memcpy(data + 4, &key, 8);
+        memcpy(data + 12, &format, 4);
+        memcpy(data + 16, &size, 4);
+
+        char fileName[RL_MAX_SHADER_CACHE_PATH_LENGTH] = { 0 };
+        int fileNameLength = snprintf(fileName, RL_MAX_SHADER_CACHE_PATH_LENGTH, "%s/%016llx.rlsb", RLGL.State.shaderCachePath, key);
+
+        if ((fileNameLength < 0) || (fileNameLength >= RL_MAX_SHADER_CACHE_PATH_LENGTH)) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Program binary cache file path too long, cache skipped", id);
+        else
+        {
+            FILE *file = fopen(fileName, "wb");
+
+            if (file != NULL)
+            {
+                size_t count = fwrite(data, 1, 20 + length, file);
+                fclose(file);
+
+                if (count != (size_t)(20 + length))
+                {
+                    TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to write program binary cache file", id);
+                    remove(fileName);
+                }
+            }
+            else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to open program binary cache file: %s", id, fileName);
+        }
+    }
+
+    RL_FREE(data);
+}
+#endif
+
 #if RLGL_SHOW_GL_DETAILS_INFO
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -68,6 +68,9 @@
     #define CGLTF_MALLOC RL_MALLOC
     #define CGLTF_FREE RL_FREE
 
+    static bool DecodeBase64GLTF(unsigned char *data, size_t size, const char *base64);
+    #define CGLTF_DECODE_BASE64 DecodeBase64GLTF
+
     #define CGLTF_IMPLEMENTATION
     #include "external/cgltf.h"         // glTF file format loading
 #endif
@@ -137,16 +140,44 @@
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH   4096      // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
+#ifndef MAX_MESH_GEN_CACHE_SIZE
+    #define MAX_MESH_GEN_CACHE_SIZE  16     // Maximum generated meshes kept in cache (by shape and parameters), 0 to disable
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if SUPPORT_MESH_GENERATION
+// Generated mesh shape types, used as mesh generation cache key
+typedef enum {
+    MESH_GEN_SPHERE = 0,
+    MESH_GEN_HEMISPHERE,
+    MESH_GEN_CYLINDER,
+    MESH_GEN_CONE,
+    MESH_GEN_TORUS,
+    MESH_GEN_KNOT
+} MeshGenShape;
+
+// Parametric surface function for mesh generation, computes vertex position and normal for (u, v) in [0..1]
+typedef void (*MeshSurfaceFunc)(float u, float v, const float *params, float *position, float *normal);
+
+// Generated mesh cache entry
+// NOTE: Only CPU vertex data is cached, every generated mesh gets its own copy and GPU buffers
+typedef struct MeshGenCacheEntry {
+    int shape;                  // Generated mesh shape type (MeshGenShape)
+    float params[4];            // Generation parameters
+    Mesh mesh;                  // Generated mesh vertex data
+    unsigned int lastUse;       // Last use counter, least recently used entry is replaced
+} MeshGenCacheEntry;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+#if SUPPORT_MESH_GENERATION && (MAX_MESH_GEN_CACHE_SIZE > 0)
+static MeshGenCacheEntry meshGenCache[MAX_MESH_GEN_CACHE_SIZE] = { 0 }; // Generated meshes cache
+static unsigned int meshGenCacheCounter = 0;                            // Generated meshes cache use counter
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -176,6 +207,24 @@ static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *mate
 // Update model vertex data (positions and normals)
 static void UpdateModelAnimationVertexBuffers(Model model);
 
+static Model LoadModelData(const char *fileName);   // Load model data from file (meshes and materials), meshes not uploaded to GPU
+
+#if SUPPORT_MESH_GENERATION
+static unsigned int *AllocMeshGenData(Mesh *mesh, int vertexCount, int triangleCount); // Allocate mesh vertex data arrays for generation
+static void FinishMeshGenData(Mesh *mesh, unsigned int *indices); // Set generated mesh indices (or expand vertex data if required)
+static void GenMeshSurfaceGrid(Mesh *mesh, unsigned int *indices, int *vertexOffset, int *triangleOffset, int slices, int stacks, MeshSurfaceFunc surface, const float *params, bool poleStart, bool poleEnd); // Generate parametric surface grid into mesh data
+static void GenMeshDiskData(Mesh *mesh, unsigned int *indices, int *vertexOffset, int *triangleOffset, int slices, Vector3 center, Vector3 axisX, Vector3 axisY, float radius, Vector3 normal, float texcoord); // Generate disk into mesh data
+static void MeshSurfaceSphere(float u, float v, const float *params, float *position, float *normal);
+static void MeshSurfaceHemiSphere(float u, float v, const float *params, float *position, float *normal);
+static void MeshSurfaceCylinder(float u, float v, const float *params, float *position, float *normal);
+static void MeshSurfaceCone(float u, float v, const float *params, float *position, float *normal);
+static void MeshSurfaceTorus(float u, float v, const float *params, float *position, float *normal);
+static void MeshSurfaceKnot(float u, float v, const float *params, float *position, float *normal);
+static Mesh CopyMeshGenData(Mesh mesh);         // Copy generated mesh vertex data
+static bool LoadMeshGenCache(int shape, const float *params, Mesh *mesh); // Load generated mesh data from cache (copy)
+static void SaveMeshGenCache(int shape, const float *params, Mesh mesh);  // Save generated mesh data into cache (copy)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1095,46 +1144,130 @@ void DrawGrid(int slices, float spacing)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
-    Model model = { 0 };
+    Model model = LoadModelData(fileName);
 
-#if SUPPORT_FILEFORMAT_OBJ
-    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if SUPPORT_FILEFORMAT_IQM
-    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
-#endif
-#if SUPPORT_FILEFORMAT_GLTF
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
-#endif
-#if SUPPORT_FILEFORMAT_VOX
-    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
-#endif
-#if SUPPORT_FILEFORMAT_M3D
-    if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
-#endif
+    // Upload vertex data to GPU (static meshes)
+    for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
 
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    return model;
+}
+
+// Reload model from file
+// NOTE: Meshes with same vertex/triangle count and vertex attributes are updated in place (VAO/VBOs kept),
+// materials are kept if material count matches (new materials are unloaded), otherwise they are replaced,
+// previous model materials shaders and textures must be unloaded by user in that case (same as UnloadModel())
+bool ReloadModel(Model *model, const char *fileName)
+{
+    bool result = false;
+
+    if (model == NULL) return result;
+
+    Model reloaded = LoadModelData(fileName);
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
+    if ((reloaded.meshCount == 0) || (reloaded.meshes == NULL))
     {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to reload model, previous model kept", fileName);
+        UnloadModel(reloaded);
+        return result;
     }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
 
-    if (model.materialCount == 0)
+    if (reloaded.meshCount != model->meshCount)
     {
-        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+        // Meshes layout changed, replace all meshes
+        for (int i = 0; i < reloaded.meshCount; i++) UploadMesh(&reloaded.meshes[i], false);
+
+        Mesh *meshes = model->meshes;
+        int meshCount = model->meshCount;
+        model->meshes = reloaded.meshes;
+        model->meshCount = reloaded.meshCount;
+        reloaded.meshes = meshes;
+        reloaded.meshCount = meshCount;
+    }
+    else
+    {
+        for (int i = 0; i < model->meshCount; i++)
+        {
+            Mesh *mesh = &model->meshes[i];
+            Mesh *update = &reloaded.meshes[i];
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+            bool match = (mesh->vboId != NULL) && (mesh->vertexCount == update->vertexCount) && (mesh->triangleCount == update->triangleCount) &&
+                ((mesh->texcoords == NULL) == (update->texcoords == NULL)) && ((mesh->texcoords2 == NULL) == (update->texcoords2 == NULL)) &&
+                ((mesh->normals == NULL) == (update->normals == NULL)) && ((mesh->tangents == NULL) == (update->tangents == NULL)) &&
+                ((mesh->colors == NULL) == (update->colors == NULL)) && ((mesh->indices == NULL) == (update->indices == NULL)) &&
+                ((mesh->boneIndices == NULL) == (update->boneIndices == NULL)) && ((mesh->boneWeights == NULL) == (update->boneWeights == NULL));
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+            if (match)
+            {
+                // Update vertex data in current GPU buffers, same as UploadMesh() layout
+                const float *vertices = (update->animVertices != NULL)? update->animVertices : update->vertices;
+                const float *normals = (update->animNormals != NULL)? update->animNormals : update->normals;
+
+                UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, vertices, update->vertexCount*3*sizeof(float), 0);
+                if (update->texcoords != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, update->texcoords, update->vertexCount*2*sizeof(float), 0);
+                if (update->normals != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, normals, update->vertexCount*3*sizeof(float), 0);
+                if (update->colors != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, update->colors, update->vertexCount*4*sizeof(unsigned char), 0);
+                if (update->tangents != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, update->tangents, update->vertexCount*4*sizeof(float), 0);
+                if (update->texcoords2 != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, update->texcoords2, update->vertexCount*2*sizeof(float), 0);
+#if SUPPORT_GPU_SKINNING
+                if (update->boneIndices != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEINDICES, update->boneIndices, update->vertexCount*4*sizeof(unsigned char), 0);
+                if (update->boneWeights != NULL) UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, update->boneWeights, update->vertexCount*4*sizeof(float), 0);
+#endif
+                if (update->indices != NULL) rlUpdateVertexBufferElements(mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES], update->indices, update->triangleCount*3*sizeof(unsigned short), 0);
+
+                // Move GPU buffers to reloaded mesh data
+                update->vaoId = mesh->vaoId;
+                update->vboId = mesh->vboId;
+                mesh->vaoId = 0;
+                mesh->vboId = NULL;
+            }
+            else UploadMesh(update, false);
+
+            Mesh temp = *mesh;
+            *mesh = *update;
+            *update = temp;
+        }
     }
 
-    return model;
+    if (reloaded.materialCount == model->materialCount)
+    {
+        // Keep current materials, unload reloaded ones (including their textures)
+        for (int i = 0; i < reloaded.materialCount; i++) UnloadMaterial(reloaded.materials[i]);
+        reloaded.materialCount = 0;
+    }
+    else
+    {
+        Material *materials = model->materials;
+        int materialCount = model->materialCount;
+        model->materials = reloaded.materials;
+        model->materialCount = reloaded.materialCount;
+        reloaded.materials = materials;
+        reloaded.materialCount = materialCount;
+    }
+
+    // Mesh-material linkage and animation data always taken from reloaded model
+    int *meshMaterial = model->meshMaterial;
+    ModelSkeleton skeleton = model->skeleton;
+    ModelAnimPose currentPose = model->currentPose;
+    Matrix *boneMatrices = model->boneMatrices;
+    model->meshMaterial = reloaded.meshMaterial;
+    model->skeleton = reloaded.skeleton;
+    model->currentPose = reloaded.currentPose;
+    model->boneMatrices = reloaded.boneMatrices;
+    reloaded.meshMaterial = meshMaterial;
+    reloaded.skeleton = skeleton;
+    reloaded.currentPose = NULL;
+    reloaded.boneMatrices = NULL;
+
+    UnloadModel(reloaded);      // Unload previous model data not kept
+
+    // NOTE: UnloadModel() does not free animation pose buffers, free previous ones here
+    RL_FREE(currentPose);
+    RL_FREE(boneMatrices);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Model reloaded successfully", fileName);
+    result = true;
+
+    return result;
 }
 
 // Load model from generated mesh
@@ -2921,6 +3054,24 @@ Mesh GenMeshSphere(float radius, int rings, int slices)
 
     if ((rings >= 3) && (slices >= 3))
     {
+#define CUSTOM_MESH_GEN_SPHERE
+#if defined(CUSTOM_MESH_GEN_SPHERE)
+        float params[4] = { radius, (float)rings, (float)slices, 0.0f };
+
+        if (!LoadMeshGenCache(MESH_GEN_SPHERE, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            // NOTE: Poles degenerate triangles are skipped
+            unsigned int *indices = AllocMeshGenData(&mesh, (slices + 1)*(rings + 1), 2*slices*rings - 2*slices);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, slices, rings, MeshSurfaceSphere, params, true, true);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_SPHERE, params, mesh);
+        }
+#else   // Use par_shapes library to generate sphere mesh
+
         par_shapes_set_epsilon_degenerate_sphere(0.0);
         par_shapes_mesh *sphere = par_shapes_create_parametric_sphere(slices, rings);
         par_shapes_scale(sphere, radius, radius, radius);
@@ -2948,6 +3099,7 @@ Mesh GenMeshSphere(float radius, int rings, int slices)
         }
 
         par_shapes_free_mesh(sphere);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -2966,6 +3118,24 @@ Mesh GenMeshHemiSphere(float radius, int rings, int slices)
     {
         if (radius < 0.0f) radius = 0.0f;
 
+#define CUSTOM_MESH_GEN_HEMISPHERE
+#if defined(CUSTOM_MESH_GEN_HEMISPHERE)
+        float params[4] = { radius, (float)rings, (float)slices, 0.0f };
+
+        if (!LoadMeshGenCache(MESH_GEN_HEMISPHERE, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            // NOTE: Poles degenerate triangles are skipped
+            unsigned int *indices = AllocMeshGenData(&mesh, (slices + 1)*(rings + 1), 2*slices*rings - 2*slices);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, slices, rings, MeshSurfaceHemiSphere, params, true, true);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_HEMISPHERE, params, mesh);
+        }
+#else   // Use par_shapes library to generate hemisphere mesh
+
         par_shapes_mesh *sphere = par_shapes_create_hemisphere(slices, rings);
         par_shapes_scale(sphere, radius, radius, radius);
         // NOTE: Soft normals are computed internally
@@ -2992,6 +3162,7 @@ Mesh GenMeshHemiSphere(float radius, int rings, int slices)
         }
 
         par_shapes_free_mesh(sphere);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -3008,6 +3179,26 @@ Mesh GenMeshCylinder(float radius, float height, int slices)
 
     if (slices >= 3)
     {
+#define CUSTOM_MESH_GEN_CYLINDER
+#if defined(CUSTOM_MESH_GEN_CYLINDER)
+        float params[4] = { radius, height, (float)slices, 0.0f };
+
+        if (!LoadMeshGenCache(MESH_GEN_CYLINDER, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            // NOTE: Cylinder side is flat along height, one stack generates same surface and texcoords
+            unsigned int *indices = AllocMeshGenData(&mesh, 2*(slices + 1) + 2*(slices + 1), 2*slices + 2*slices);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, slices, 1, MeshSurfaceCylinder, params, false, false);
+            GenMeshDiskData(&mesh, indices, &vertexOffset, &triangleOffset, slices, (Vector3){ 0.0f, height, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, radius, (Vector3){ 0.0f, 1.0f, 0.0f }, 0.0f);
+            GenMeshDiskData(&mesh, indices, &vertexOffset, &triangleOffset, slices, (Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, radius, (Vector3){ 0.0f, -1.0f, 0.0f }, 0.95f);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_CYLINDER, params, mesh);
+        }
+#else   // Use par_shapes library to generate cylinder mesh
+
         // Instance a cylinder that sits on the Z=0 plane using the given tessellation
         // levels across the UV domain.  Think of "slices" like a number of pizza
         // slices, and "stacks" like a number of stacked rings
@@ -3056,6 +3247,7 @@ Mesh GenMeshCylinder(float radius, float height, int slices)
         }
 
         par_shapes_free_mesh(cylinder);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -3072,6 +3264,26 @@ Mesh GenMeshCone(float radius, float height, int slices)
 
     if (slices >= 3)
     {
+#define CUSTOM_MESH_GEN_CONE
+#if defined(CUSTOM_MESH_GEN_CONE)
+        float params[4] = { radius, height, (float)slices, 0.0f };
+
+        if (!LoadMeshGenCache(MESH_GEN_CONE, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            // NOTE: Cone side is flat along height, one stack generates same surface and texcoords,
+            // apex degenerate triangles are skipped
+            unsigned int *indices = AllocMeshGenData(&mesh, 2*(slices + 1) + (slices + 1), slices + slices);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, slices, 1, MeshSurfaceCone, params, false, true);
+            GenMeshDiskData(&mesh, indices, &vertexOffset, &triangleOffset, slices, (Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, radius, (Vector3){ 0.0f, -1.0f, 0.0f }, 0.95f);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_CONE, params, mesh);
+        }
+#else   // Use par_shapes library to generate cone mesh
+
         // Instance a cone that sits on the Z=0 plane using the given tessellation
         // levels across the UV domain.  Think of "slices" like a number of pizza
         // slices, and "stacks" like a number of stacked rings
@@ -3111,6 +3323,7 @@ Mesh GenMeshCone(float radius, float height, int slices)
         }
 
         par_shapes_free_mesh(cone);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -3130,6 +3343,23 @@ Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
         if (radius > 1.0f) radius = 1.0f;
         else if (radius < 0.1f) radius = 0.1f;
 
+#define CUSTOM_MESH_GEN_TORUS
+#if defined(CUSTOM_MESH_GEN_TORUS)
+        float params[4] = { radius, size/2, (float)radSeg, (float)sides };
+
+        if (!LoadMeshGenCache(MESH_GEN_TORUS, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            unsigned int *indices = AllocMeshGenData(&mesh, (radSeg + 1)*(sides + 1), 2*radSeg*sides);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, radSeg, sides, MeshSurfaceTorus, params, false, false);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_TORUS, params, mesh);
+        }
+#else   // Use par_shapes library to generate torus mesh
+
         // Create a donut that sits on the Z=0 plane with the specified inner radius
         // The outer radius can be controlled with par_shapes_scale
         par_shapes_mesh *torus = par_shapes_create_torus(radSeg, sides, radius);
@@ -3157,6 +3387,7 @@ Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
         }
 
         par_shapes_free_mesh(torus);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -3176,6 +3407,23 @@ Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
         if (radius > 3.0f) radius = 3.0f;
         else if (radius < 0.5f) radius = 0.5f;
 
+#define CUSTOM_MESH_GEN_KNOT
+#if defined(CUSTOM_MESH_GEN_KNOT)
+        float params[4] = { radius, size, (float)radSeg, (float)sides };
+
+        if (!LoadMeshGenCache(MESH_GEN_KNOT, params, &mesh))
+        {
+            int vertexOffset = 0;
+            int triangleOffset = 0;
+
+            unsigned int *indices = AllocMeshGenData(&mesh, (radSeg + 1)*(sides + 1), 2*radSeg*sides);
+            GenMeshSurfaceGrid(&mesh, indices, &vertexOffset, &triangleOffset, radSeg, sides, MeshSurfaceKnot, params, false, false);
+            FinishMeshGenData(&mesh, indices);
+
+            SaveMeshGenCache(MESH_GEN_KNOT, params, mesh);
+        }
+#else   // Use par_shapes library to generate knot mesh
+
         par_shapes_mesh *knot = par_shapes_create_trefoil_knot(radSeg, sides, radius);
         par_shapes_scale(knot, size, size, size);
 
@@ -3201,6 +3449,7 @@ Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
         }
 
         par_shapes_free_mesh(knot);
+#endif
 
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
@@ -3692,6 +3941,24 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 }
 #endif // SUPPORT_MESH_GENERATION
 
+// Unload generated meshes cache
+// NOTE: Called on CloseWindow(), generated meshes cache is only CPU data
+void UnloadMeshGenCache(void)
+{
+#if SUPPORT_MESH_GENERATION && (MAX_MESH_GEN_CACHE_SIZE > 0)
+    for (int i = 0; i < MAX_MESH_GEN_CACHE_SIZE; i++)
+    {
+        RL_FREE(meshGenCache[i].mesh.vertices);
+        RL_FREE(meshGenCache[i].mesh.normals);
+        RL_FREE(meshGenCache[i].mesh.texcoords);
+        RL_FREE(meshGenCache[i].mesh.indices);
+    }
+
+    memset(meshGenCache, 0, sizeof(meshGenCache));
+    meshGenCacheCounter = 0;
+#endif
+}
+
 // Compute mesh bounding box limits
 // NOTE: minVertex and maxVertex should be transformed by model transform matrix
 BoundingBox GetMeshBoundingBox(Mesh mesh)
@@ -4377,6 +4644,355 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
+// Load model data from file (meshes and materials), meshes not uploaded to GPU
+static Model LoadModelData(const char *fileName)
+{
+    Model model = { 0 };
+
+#if SUPPORT_FILEFORMAT_OBJ
+    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
+#endif
+#if SUPPORT_FILEFORMAT_IQM
+    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#endif
+#if SUPPORT_FILEFORMAT_GLTF
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
+#endif
+#if SUPPORT_FILEFORMAT_VOX
+    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
+#endif
+#if SUPPORT_FILEFORMAT_M3D
+    if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
+#endif
+
+    // Make sure model transform is set to identity matrix!
+    model.transform = MatrixIdentity();
+
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+
+    if (model.materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+
+        model.materialCount = 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();
+
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    }
+
+    return model;
+}
+
+#if SUPPORT_MESH_GENERATION
+// Allocate mesh vertex data arrays for generation (positions, normals and texcoords)
+// NOTE: Returned indices array (32bit) must be provided to FinishMeshGenData()
+static unsigned int *AllocMeshGenData(Mesh *mesh, int vertexCount, int triangleCount)
+{
+    mesh->vertexCount = vertexCount;
+    mesh->triangleCount = triangleCount;
+    mesh->vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh->normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh->texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+
+    return (unsigned int *)RL_MALLOC(triangleCount*3*sizeof(unsigned int));
+}
+
+// Set generated mesh indices, vertex data is expanded (no indices) if vertex count exceeds 16bit indices range
+static void FinishMeshGenData(Mesh *mesh, unsigned int *indices)
+{
+    if (mesh->vertexCount <= 65535)
+    {
+        mesh->indices = (unsigned short *)RL_MALLOC(mesh->triangleCount*3*sizeof(unsigned short));
+        for (int i = 0; i < mesh->triangleCount*3; i++) mesh->indices[i] = (unsigned short)indices[i];
+    }
+    else
+    {
+        int vertexCount = mesh->triangleCount*3;
+        float *vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+        float *normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+        float *texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+
+        for (int i = 0; i < vertexCount; i++)
+        {
+            unsigned int k = indices[i];
+            memcpy(&vertices[i*3], &mesh->vertices[k*3], 3*sizeof(float));
+            memcpy(&normals[i*3], &mesh->normals[k*3], 3*sizeof(float));
+            memcpy(&texcoords[i*2], &mesh->texcoords[k*2], 2*sizeof(float));
+        }
+
+        RL_FREE(mesh->vertices);
+        RL_FREE(mesh->normals);
+        RL_FREE(mesh->texcoords);
+
+        mesh->vertices = vertices;
+        mesh->normals = normals;
+        mesh->texcoords = texcoords;
+        mesh->vertexCount = vertexCount;
+    }
+
+    RL_FREE(indices);
+}
+
+// Generate parametric surface grid into mesh data, starting at provided vertex/triangle offsets
+// NOTE: Grid layout, texcoords and winding are the same as par_shapes_create_parametric(),
+// first/last rows can be defined as poles (all points equal) to skip their degenerate triangles
+static void GenMeshSurfaceGrid(Mesh *mesh, unsigned int *indices, int *vertexOffset, int *triangleOffset, int slices, int stacks, MeshSurfaceFunc surface, const float *params, bool poleStart, bool poleEnd)
+{
+    int v = *vertexOffset;
+
+    for (int stack = 0; stack <= stacks; stack++)
+    {
+        float u0 = (float)stack/stacks;
+
+        for (int slice = 0; slice <= slices; slice++, v++)
+        {
+            float u1 = (float)slice/slices;
+
+            surface(u0, u1, params, &mesh->vertices[v*3], &mesh->normals[v*3]);
+            mesh->texcoords[v*2] = u0;
+            mesh->texcoords[v*2 + 1] = u1;
+        }
+    }
+
+    unsigned int *index = &indices[(*triangleOffset)*3];
+    int row = *vertexOffset;
+
+    for (int stack = 0; stack < stacks; stack++, row += slices + 1)
+    {
+        for (int slice = 0; slice < slices; slice++)
+        {
+            int current = row + slice;
+            int next = row + slice + 1;
+
+            if (!(poleStart && (stack == 0)))
+            {
+                *index++ = current + slices + 1;
+                *index++ = next;
+                *index++ = current;
+            }
+
+            if (!(poleEnd && (stack == (stacks - 1))))
+            {
+                *index++ = current + slices + 1;
+                *index++ = next + slices + 1;
+                *index++ = next;
+            }
+        }
+    }
+
+    *vertexOffset = v;
+    *triangleOffset = (int)(index - indices)/3;
+}
+
+// Generate disk (triangle fan) into mesh data, starting at provided vertex/triangle offsets
+// NOTE: Disk points are center + radius*(cos(angle)*axisX + sin(angle)*axisY), all texcoords set to provided value
+static void GenMeshDiskData(Mesh *mesh, unsigned int *indices, int *vertexOffset, int *triangleOffset, int slices, Vector3 center, Vector3 axisX, Vector3 axisY, float radius, Vector3 normal, float texcoord)
+{
+    int first = *vertexOffset;
+    float *vertices = &mesh->vertices[first*3];
+    float *normals = &mesh->normals[first*3];
+    float *texcoords = &mesh->texcoords[first*2];
+
+    for (int i = 0; i <= slices; i++)
+    {
+        Vector3 point = center;
+
+        if (i > 0)
+        {
+            float angle = (i - 1)*2.0f*PI/slices;
+            float c = cosf(angle)*radius;
+            float s = sinf(angle)*radius;
+
+            point.x += c*axisX.x + s*axisY.x;
+            point.y += c*axisX.y + s*axisY.y;
+            point.z += c*axisX.z + s*axisY.z;
+        }
+
+        vertices[i*3] = point.x;
+        vertices[i*3 + 1] = point.y;
+        vertices[i*3 + 2] = point.z;
+        normals[i*3] = normal.x;
+        normals[i*3 + 1] = normal.y;
+        normals[i*3 + 2] = normal.z;
+        texcoords[i*2] = texcoord;
+        texcoords[i*2 + 1] = texcoord;
+    }
+
+    unsigned int *index = &indices[(*triangleOffset)*3];
+
+    for (int i = 0; i < slices; i++)
+    {
+        *index++ = first;
+        *index++ = first + 1 + i;
+        *index++ = first + 1 + (i + 1)%slices;
+    }
+
+    *vertexOffset = first + slices + 1;
+    *triangleOffset += slices;
+}
+
+// Parametric surfaces for mesh generation
+// NOTE: Same parametrization as par_shapes, including the transformations applied by GenMesh*() functions
+static void MeshSurfaceSphere(float u, float v, const float *params, float *position, float *normal)
+{
+    float phi = u*PI;
+    float theta = v*2.0f*PI;
+
+    normal[0] = cosf(theta)*sinf(phi);
+    normal[1] = sinf(theta)*sinf(phi);
+    normal[2] = cosf(phi);
+
+    for (int i = 0; i < 3; i++) position[i] = normal[i]*params[0];
+}
+
+static void MeshSurfaceHemiSphere(float u, float v, const float *params, float *position, float *normal)
+{
+    float phi = u*PI;
+    float theta = v*PI;
+
+    normal[0] = cosf(theta)*sinf(phi);
+    normal[1] = sinf(theta)*sinf(phi);
+    normal[2] = cosf(phi);
+
+    for (int i = 0; i < 3; i++) position[i] = normal[i]*params[0];
+}
+
+static void MeshSurfaceCylinder(float u, float v, const float *params, float *position, float *normal)
+{
+    float theta = v*2.0f*PI;
+
+    normal[0] = sinf(theta);
+    normal[1] = 0.0f;
+    normal[2] = -cosf(theta);
+
+    position[0] = normal[0]*params[0];
+    position[1] = u*params[1];
+    position[2] = normal[2]*params[0];
+}
+
+static void MeshSurfaceCone(float u, float v, const float *params, float *position, float *normal)
+{
+    float theta = v*2.0f*PI;
+    float radius = (1.0f - u)*params[0];
+    float length = sqrtf(params[0]*params[0] + params[1]*params[1]);
+    if (length == 0.0f) length = 1.0f;
+
+    position[0] = -cosf(theta)*radius;
+    position[1] = u*params[1];
+    position[2] = -sinf(theta)*radius;
+
+    normal[0] = -cosf(theta)*params[1]/length;
+    normal[1] = params[0]/length;
+    normal[2] = -sinf(theta)*params[1]/length;
+}
+
+static void MeshSurfaceTorus(float u, float v, const float *params, float *position, float *normal)
+{
+    float theta = u*2.0f*PI;
+    float phi = v*2.0f*PI;
+    float beta = 1.0f + params[0]*cosf(phi);
+    float scale = params[1];
+
+    position[0] = cosf(theta)*beta*scale;
+    position[1] = sinf(theta)*beta*scale;
+    position[2] = sinf(phi)*params[0]*scale;
+
+    normal[0] = cosf(theta)*cosf(phi);
+    normal[1] = sinf(theta)*cosf(phi);
+    normal[2] = sinf(phi);
+}
+
+static void MeshSurfaceKnot(float u, float v, const float *params, float *position, float *normal)
+{
+    const float a = 0.5f;
+    const float b = 0.3f;
+    const float c = 0.5f;
+    const float d = params[0]*0.1f;
+    float t = (1.0f - u)*4.0f*PI;
+    float angle = v*2.0f*PI;
+
+    float r = a + b*cosf(1.5f*t);
+    Vector3 q = Vector3Normalize((Vector3){ -1.5f*b*sinf(1.5f*t)*cosf(t) - r*sinf(t), -1.5f*b*sinf(1.5f*t)*sinf(t) + r*cosf(t), 1.5f*c*cosf(1.5f*t) });
+    Vector3 qvn = Vector3Normalize((Vector3){ q.y, -q.x, 0.0f });
+    Vector3 ww = Vector3CrossProduct(q, qvn);
+
+    normal[0] = qvn.x*cosf(angle) + ww.x*sinf(angle);
+    normal[1] = qvn.y*cosf(angle) + ww.y*sinf(angle);
+    normal[2] = ww.z*sinf(angle);
+
+    position[0] = (r*cosf(t) + d*normal[0])*params[1];
+    position[1] = (r*sinf(t) + d*normal[1])*params[1];
+    position[2] = (c*sinf(1.5f*t) + d*normal[2])*params[1];
+}
+
+// Copy generated mesh vertex data (positions, normals, texcoords and indices)
+static Mesh CopyMeshGenData(Mesh mesh)
+{
+    Mesh copy = { 0 };
+
+    copy.vertexCount = mesh.vertexCount;
+    copy.triangleCount = mesh.triangleCount;
+    copy.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    copy.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    copy.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    memcpy(copy.vertices, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+    memcpy(copy.normals, mesh.normals, mesh.vertexCount*3*sizeof(float));
+    memcpy(copy.texcoords, mesh.texcoords, mesh.vertexCount*2*sizeof(float));
+
+    if (mesh.indices != NULL)
+    {
+        copy.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+        memcpy(copy.indices, mesh.indices, mesh.triangleCount*3*sizeof(unsigned short));
+    }
+
+    return copy;
+}
+
+// Load generated mesh data from cache (copy), returns false if not found
+static bool LoadMeshGenCache(int shape, const float *params, Mesh *mesh)
+{
+#if MAX_MESH_GEN_CACHE_SIZE > 0
+    for (int i = 0; i < MAX_MESH_GEN_CACHE_SIZE; i++)
+    {
+        MeshGenCacheEntry *entry = &meshGenCache[i];
+
+        if ((entry->mesh.vertices != NULL) && (entry->shape == shape) && (memcmp(entry->params, params, 4*sizeof(float)) == 0))
+        {
+            *mesh = CopyMeshGenData(entry->mesh);
+            entry->lastUse = ++meshGenCacheCounter;
+            return true;
+        }
+    }
+#endif
+
+    return false;
+}
+
+// Save generated mesh data into cache (copy), least recently used entry is replaced
+static void SaveMeshGenCache(int shape, const float *params, Mesh mesh)
+{
+#if MAX_MESH_GEN_CACHE_SIZE > 0
+    MeshGenCacheEntry *entry = &meshGenCache[0];
+
+    for (int i = 1; i < MAX_MESH_GEN_CACHE_SIZE; i++)
+    {
+        if (meshGenCache[i].lastUse < entry->lastUse) entry = &meshGenCache[i];
+    }
+
+    RL_FREE(entry->mesh.vertices);
+    RL_FREE(entry->mesh.normals);
+    RL_FREE(entry->mesh.texcoords);
+    RL_FREE(entry->mesh.indices);
+
+    entry->shape = shape;
+    memcpy(entry->params, params, 4*sizeof(float));
+    entry->mesh = CopyMeshGenData(mesh);
+    entry->lastUse = ++meshGenCacheCounter;
+#endif
+}
+#endif // SUPPORT_MESH_GENERATION
+
 #if SUPPORT_FILEFORMAT_IQM || SUPPORT_FILEFORMAT_GLTF
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -5276,6 +5892,31 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
 #endif
 
 #if SUPPORT_FILEFORMAT_GLTF
+// Decode embedded Base64 buffer for cgltf, using core Base64 decoder
+// NOTE: Decodes exactly size bytes, trailing text (padding) is ignored
+static bool DecodeBase64GLTF(unsigned char *data, size_t size, const char *base64)
+{
+    if ((size/3) >= 0x1fffffff) return false;   // Text size must fit into int
+
+    int fullSize = (int)(size/3)*4;
+    int remainder = (int)(size%3);
+    int requiredSize = fullSize + ((remainder > 0)? (remainder + 1) : 0);
+
+    // Make sure enough text is available before decoding, block decoders read ahead
+    if (memchr(base64, '\0', requiredSize) != NULL) return false;
+
+    if (DecodeDataBase64ToBuffer(base64, fullSize, data, (int)size) < 0) return false;
+
+    if (remainder > 0)
+    {
+        unsigned char tail[3] = { 0 };
+        if (DecodeDataBase64ToBuffer(base64 + fullSize, remainder + 1, tail, 3) != remainder) return false;
+        memcpy(data + size - remainder, tail, remainder);
+    }
+
+    return true;
+}
+
 // Load file data callback for cgltf
 static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
 {
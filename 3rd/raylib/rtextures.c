@@ -107,6 +107,13 @@
 #endif
 #if SUPPORT_FILEFORMAT_KTX
     #define RL_GPUTEX_SUPPORT_KTX
+    #define RL_GPUTEX_SUPPORT_KTX2
+    static bool IsPixelFormatSupportedGPU(int format);  // Check GPU support for a pixel format, used to select KTX2 transcode target
+    #define RL_GPUTEX_FORMAT_SUPPORTED(format) IsPixelFormatSupportedGPU(format)
+    #if SUPPORT_COMPRESSION_API
+        #include "external/sinfl.h"         // Required for: zsinflate()
+        #define RL_GPUTEX_ZLIB_DECOMPRESS(dst, dst_size, src, src_size) zsinflate(dst, dst_size, src, src_size)
+    #endif
 #endif
 #if SUPPORT_FILEFORMAT_PVR
     #define RL_GPUTEX_SUPPORT_PVR
@@ -528,6 +535,10 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     {
         image.data = rl_load_ktx_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
     }
+    else if ((strcmp(fileType, ".ktx2") == 0) || (strcmp(fileType, ".KTX2") == 0))
+    {
+        image.data = rl_load_ktx2_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
 #endif
 #if SUPPORT_FILEFORMAT_PVR
     else if ((strcmp(fileType, ".pvr") == 0) || (strcmp(fileType, ".PVR") == 0))
@@ -4145,6 +4156,51 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
+// Reload texture from file
+// NOTE: Texture data is updated in place (texture id and parameters kept) if image size and format
+// match and format is uncompressed, otherwise a new texture is loaded and previous one unloaded
+bool ReloadTexture(Texture2D *texture, const char *fileName)
+{
+    bool result = false;
+
+    if (texture == NULL) return result;
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        if ((texture->id > 0) && (image.width == texture->width) && (image.height == texture->height) &&
+            (image.format == texture->format) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            // NOTE: Only base level is uploaded, mipmaps are regenerated if required
+            UpdateTexture(*texture, image.data);
+            if (texture->mipmaps > 1) GenTextureMipmaps(texture);
+
+            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture reloaded successfully", texture->id);
+            result = true;
+        }
+        else
+        {
+            Texture2D reloaded = LoadTextureFromImage(image);
+
+            if (reloaded.id > 0)
+            {
+                TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture reloaded successfully, size or format changed (new ID %i)", texture->id, reloaded.id);
+
+                UnloadTexture(*texture);
+                *texture = reloaded;
+                result = true;
+            }
+        }
+
+        UnloadImage(image);
+    }
+
+    if (!result) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to reload texture, previous texture kept", fileName);
+
+    return result;
+}
+
 // Load cubemap from image, multiple image cubemap layouts supported
 TextureCubemap LoadTextureCubemap(Image image, int layout)
 {
@@ -5403,6 +5459,21 @@ int GetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
+#if SUPPORT_FILEFORMAT_KTX
+// Check if a pixel format can be loaded by the GPU, depends on available extensions
+// NOTE: rlGetGlTextureFormats() returns no internal format for unsupported compressed formats
+static bool IsPixelFormatSupportedGPU(int format)
+{
+    unsigned int glInternalFormat = 0;
+    unsigned int glFormat = 0;
+    unsigned int glType = 0;
+
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    return (glInternalFormat != 0);
+}
+#endif
+
 // Convert half-float (stored as unsigned short) to float
 // REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
 static float HalfToFloat(unsigned short x)
@@ -0,0 +1,202 @@
+// Keeps several buffer readbacks in flight and completes them through wgpuInstanceProcessEvents,
+// doing CPU work in between instead of blocking on each map. Needs a Vulkan device (e.g. lavapipe):
+//   cc -I.. -I../.. test_map_async.c ../wgvk.c -lm -lpthread -ldl
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <wgvk.h>
+
+static int g_test_failures = 0;
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "TEST FAILED: %s at %s:%d\n", #condition, __FILE__, __LINE__); \
+            g_test_failures++; \
+        } \
+    } while (0)
+
+#define SLOT_COUNT 4
+#define READBACK_SIZE (4u << 20)
+#define READBACK_COUNT 48
+
+static WGPUAdapter g_adapter;
+static WGPUDevice g_device;
+
+typedef struct Slot {
+    WGPUBuffer buffer;
+    WGPUFuture future;
+    uint32_t expectedFirst;
+    bool busy;
+    bool mapped;
+} Slot;
+
+static void onAdapter(WGPURequestAdapterStatus status, WGPUAdapter adapter, WGPUStringView message, void* userdata1, void* userdata2) {
+    g_adapter = status == WGPURequestAdapterStatus_Success ? adapter : NULL;
+}
+static void onDevice(WGPURequestDeviceStatus status, WGPUDevice device, WGPUStringView message, void* userdata1, void* userdata2) {
+    g_device = status == WGPURequestDeviceStatus_Success ? device : NULL;
+}
+static void onMapped(WGPUMapAsyncStatus status, WGPUStringView message, void* userdata1, void* userdata2) {
+    Slot* slot = (Slot*)userdata1;
+    TEST_ASSERT(status == WGPUMapAsyncStatus_Success);
+    slot->mapped = true;
+}
+
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static volatile uint32_t g_sink;
+static void cpuWork(void) {
+    uint32_t h = 0;
+    for (uint32_t i = 0; i < 1000000; i++) h = h * 31u + i;
+    g_sink = h;
+}
+
+// Runs READBACK_COUNT readbacks with up to inFlight of them outstanding, returns readbacks per second
+static double runReadbacks(WGPUInstance instance, WGPUQueue queue, WGPUBuffer source, Slot* slots, int inFlight) {
+    WGPUBufferMapCallbackInfo callbackInfo = {
+        .mode = WGPUCallbackMode_AllowProcessEvents,
+        .callback = onMapped,
+    };
+    int issued = 0, completed = 0;
+    const double start = seconds();
+
+    while (completed < READBACK_COUNT) {
+        for (int s = 0; s < inFlight && issued < READBACK_COUNT; s++) {
+            Slot* slot = &slots[s];
+            if (slot->busy) continue;
+
+            // Each readback copies the source at a different offset so stale data is detected
+            const uint32_t shift = (uint32_t)(issued % 16) * 4;
+            WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_device, NULL);
+            wgpuCommandEncoderCopyBufferToBuffer(encoder, source, shift, slot->buffer, 0, READBACK_SIZE / 2);
+            WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, NULL);
+            wgpuQueueSubmit(queue, 1, &commandBuffer);
+            wgpuCommandBufferRelease(commandBuffer);
+            wgpuCommandEncoderRelease(encoder);
+
+            slot->expectedFirst = shift / 4;
+            slot->busy = true;
+            slot->mapped = false;
+            callbackInfo.userdata1 = slot;
+            slot->future = wgpuBufferMapAsync(slot->buffer, WGPUMapMode_Read, 0, READBACK_SIZE / 2, callbackInfo);
+            issued++;
+        }
+
+        if (inFlight == 1) {
+            WGPUFutureWaitInfo waitInfo = { .future = slots[0].future };
+            TEST_ASSERT(wgpuInstanceWaitAny(instance, 1, &waitInfo, UINT64_MAX) == WGPUWaitStatus_Success);
+        } else {
+            wgpuInstanceProcessEvents(instance);
+        }
+        cpuWork();
+
+        for (int s = 0; s < inFlight; s++) {
+            Slot* slot = &slots[s];
+            if (!slot->busy || !slot->mapped) continue;
+            const uint32_t* data = (const uint32_t*)wgpuBufferGetConstMappedRange(slot->buffer, 0, READBACK_SIZE / 2);
+            TEST_ASSERT(data[0] == slot->expectedFirst);
+            TEST_ASSERT(data[READBACK_SIZE / 8 - 1] == slot->expectedFirst + READBACK_SIZE / 8 - 1);
+            wgpuBufferUnmap(slot->buffer);
+            slot->busy = false;
+            completed++;
+        }
+    }
+    return READBACK_COUNT / (seconds() - start);
+}
+
+void test_wait_any_timeout(WGPUInstance instance, WGPUQueue queue, WGPUBuffer source, Slot* slot) {
+    printf("--- Running test_wait_any_timeout ---\n");
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_device, NULL);
+    for (int i = 0; i < 16; i++) {
+        wgpuCommandEncoderCopyBufferToBuffer(encoder, source, 0, slot->buffer, 0, READBACK_SIZE);
+    }
+    WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, NULL);
+    wgpuQueueSubmit(queue, 1, &commandBuffer);
+    wgpuCommandBufferRelease(commandBuffer);
+    wgpuCommandEncoderRelease(encoder);
+
+    slot->mapped = false;
+    WGPUBufferMapCallbackInfo callbackInfo = { .mode = WGPUCallbackMode_WaitAnyOnly, .callback = onMapped, .userdata1 = slot };
+    WGPUFutureWaitInfo waitInfo = { .future = wgpuBufferMapAsync(slot->buffer, WGPUMapMode_Read, 0, READBACK_SIZE, callbackInfo) };
+
+    // The callback must not fire before the copies are done, nor from ProcessEvents for WaitAnyOnly futures
+    WGPUWaitStatus status = wgpuInstanceWaitAny(instance, 1, &waitInfo, 0);
+    TEST_ASSERT(status == WGPUWaitStatus_TimedOut || slot->mapped);
+    wgpuInstanceProcessEvents(instance);
+    TEST_ASSERT(status == WGPUWaitStatus_Success || !slot->mapped);
+
+    TEST_ASSERT(wgpuInstanceWaitAny(instance, 1, &waitInfo, UINT64_MAX) == WGPUWaitStatus_Success);
+    TEST_ASSERT(waitInfo.completed);
+    TEST_ASSERT(slot->mapped);
+    TEST_ASSERT(wgpuBufferGetMapState(slot->buffer) == WGPUBufferMapState_Mapped);
+    wgpuBufferUnmap(slot->buffer);
+}
+
+int main() {
+    WGPUInstance instance = wgpuCreateInstance(NULL);
+    if (!instance) {
+        printf("No Vulkan available, skipping\n");
+        return 0;
+    }
+    WGPURequestAdapterOptions adapterOptions = {0};
+    WGPUFutureWaitInfo adapterWait = { wgpuInstanceRequestAdapter(instance, &adapterOptions, (WGPURequestAdapterCallbackInfo){ .callback = onAdapter }) };
+    wgpuInstanceWaitAny(instance, 1, &adapterWait, UINT64_MAX);
+    if (!g_adapter) {
+        printf("No adapter available, skipping\n");
+        return 0;
+    }
+    WGPUDeviceDescriptor deviceDescriptor = {0};
+    WGPUFutureWaitInfo deviceWait = { wgpuAdapterRequestDevice(g_adapter, &deviceDescriptor, (WGPURequestDeviceCallbackInfo){ .callback = onDevice }) };
+    wgpuInstanceWaitAny(instance, 1, &deviceWait, UINT64_MAX);
+    TEST_ASSERT(g_device != NULL);
+    if (!g_device) return 1;
+    WGPUQueue queue = wgpuDeviceGetQueue(g_device);
+
+    uint32_t* contents = malloc(READBACK_SIZE);
+    for (uint32_t i = 0; i < READBACK_SIZE / 4; i++) contents[i] = i;
+    const WGPUBufferDescriptor sourceDescriptor = {
+        .size = READBACK_SIZE,
+        .usage = WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst,
+    };
+    WGPUBuffer source = wgpuDeviceCreateBuffer(g_device, &sourceDescriptor);
+    wgpuQueueWriteBuffer(queue, source, 0, contents, READBACK_SIZE);
+    free(contents);
+
+    Slot slots[SLOT_COUNT] = {0};
+    const WGPUBufferDescriptor readbackDescriptor = {
+        .size = READBACK_SIZE,
+        .usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst,
+    };
+    for (int s = 0; s < SLOT_COUNT; s++) {
+        slots[s].buffer = wgpuDeviceCreateBuffer(g_device, &readbackDescriptor);
+    }
+
+    test_wait_any_timeout(instance, queue, source, &slots[0]);
+
+    printf("--- Running readback throughput ---\n");
+    const double blocking = runReadbacks(instance, queue, source, slots, 1);
+    const double overlapped = runReadbacks(instance, queue, source, slots, SLOT_COUNT);
+    printf("1 in flight, wgpuInstanceWaitAny:          %.1f readbacks/s\n", blocking);
+    printf("%d in flight, wgpuInstanceProcessEvents:    %.1f readbacks/s\n", SLOT_COUNT, overlapped);
+
+    for (int s = 0; s < SLOT_COUNT; s++) {
+        wgpuBufferRelease(slots[s].buffer);
+    }
+    wgpuBufferRelease(source);
+
+    if (g_test_failures == 0) {
+        printf("\nAll tests passed!\n");
+        return 0;
+    } else {
+        printf("\n%d test(s) failed.\n", g_test_failures);
+        return 1;
+    }
+}
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+#include <wgvk.h>
+#include <wgvk_structs_impl.h>
+
+static int g_test_failures = 0;
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "TEST FAILED: %s at %s:%d\n", #condition, __FILE__, __LINE__); \
+            g_test_failures++; \
+        } \
+    } while (0)
+
+#define DL     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+#define HV     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+#define HC     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+#define CACHED VK_MEMORY_PROPERTY_HOST_CACHED_BIT
+
+static VkPhysicalDeviceMemoryProperties makeProperties(const VkMemoryPropertyFlags* flags, const uint32_t* heaps, uint32_t count) {
+    VkPhysicalDeviceMemoryProperties props;
+    memset(&props, 0, sizeof(props));
+    props.memoryTypeCount = count;
+    for (uint32_t i = 0; i < count; i++) {
+        props.memoryTypes[i].propertyFlags = flags[i];
+        props.memoryTypes[i].heapIndex = heaps[i];
+        if (heaps[i] + 1 > props.memoryHeapCount) props.memoryHeapCount = heaps[i] + 1;
+    }
+    return props;
+}
+
+static uint32_t selectType(const VkPhysicalDeviceMemoryProperties* props, WGPUBufferUsage usage) {
+    return wgvkSelectBufferMemoryType(props, ~0u, usage);
+}
+
+static const WGPUBufferUsage vertexUsage  = WGPUBufferUsage_Vertex | WGPUBufferUsage_Index | WGPUBufferUsage_CopyDst;
+static const WGPUBufferUsage storageUsage = WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst;
+static const WGPUBufferUsage uniformUsage = WGPUBufferUsage_Uniform | WGPUBufferUsage_CopyDst;
+static const WGPUBufferUsage readUsage    = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst;
+static const WGPUBufferUsage writeUsage   = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+
+void test_discrete_without_rebar() {
+    printf("--- Running test_discrete_without_rebar ---\n");
+    // Typical discrete GPU: VRAM, system memory, the 256MB BAR window
+    const VkMemoryPropertyFlags flags[] = { DL, HV | HC, HV | HC | CACHED, DL | HV | HC };
+    const uint32_t heaps[]              = { 0,  1,       1,                2 };
+    VkPhysicalDeviceMemoryProperties props = makeProperties(flags, heaps, 4);
+
+    TEST_ASSERT(selectType(&props, vertexUsage) == 0);
+    TEST_ASSERT(selectType(&props, storageUsage) == 0);
+    TEST_ASSERT(selectType(&props, uniformUsage) == 3);
+    TEST_ASSERT(selectType(&props, readUsage) == 2);
+    TEST_ASSERT(selectType(&props, writeUsage) == 1);
+}
+
+void test_discrete_with_rebar() {
+    printf("--- Running test_discrete_with_rebar ---\n");
+    // Resizable BAR: all of VRAM is host visible, listed after the plain device local type
+    const VkMemoryPropertyFlags flags[] = { DL, HV | HC, DL | HV | HC, HV | HC | CACHED };
+    const uint32_t heaps[]              = { 0,  1,       0,            1 };
+    VkPhysicalDeviceMemoryProperties props = makeProperties(flags, heaps, 4);
+
+    TEST_ASSERT(selectType(&props, vertexUsage) == 0);
+    TEST_ASSERT(props.memoryTypes[selectType(&props, uniformUsage)].heapIndex == 0);
+    TEST_ASSERT(selectType(&props, uniformUsage) == 2);
+    TEST_ASSERT(selectType(&props, writeUsage) == 1);
+    TEST_ASSERT(selectType(&props, readUsage) == 3);
+}
+
+void test_unified_memory() {
+    printf("--- Running test_unified_memory ---\n");
+    // Integrated GPU / lavapipe: everything is device local and host visible
+    const VkMemoryPropertyFlags flags[] = { DL | HV | HC, DL | HV | HC | CACHED };
+    const uint32_t heaps[]              = { 0,            0 };
+    VkPhysicalDeviceMemoryProperties props = makeProperties(flags, heaps, 2);
+
+    TEST_ASSERT(selectType(&props, vertexUsage) == 0);
+    TEST_ASSERT(selectType(&props, uniformUsage) == 0);
+    TEST_ASSERT(selectType(&props, writeUsage) == 0);
+    TEST_ASSERT(selectType(&props, readUsage) == 1);
+}
+
+void test_memory_type_bits_and_fallbacks() {
+    printf("--- Running test_memory_type_bits_and_fallbacks ---\n");
+    const VkMemoryPropertyFlags flags[] = { DL | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, DL, HV | HC, HV };
+    const uint32_t heaps[]              = { 0,                                            0,  1,       1 };
+    VkPhysicalDeviceMemoryProperties props = makeProperties(flags, heaps, 4);
+
+    // Lazily allocated memory is never used for buffers
+    TEST_ASSERT(selectType(&props, vertexUsage) == 1);
+
+    // Device local type excluded by the buffer's requirements: fall back to whatever is allowed
+    TEST_ASSERT(wgvkSelectBufferMemoryType(&props, 1u << 2, vertexUsage) == 2);
+    TEST_ASSERT(wgvkSelectBufferMemoryType(&props, 1u << 2, uniformUsage) == 2);
+
+    // Mappable buffers never go to non-coherent memory
+    TEST_ASSERT(wgvkSelectBufferMemoryType(&props, 1u << 3, readUsage) == UINT32_MAX);
+    TEST_ASSERT(wgvkSelectBufferMemoryType(&props, 1u << 3, writeUsage) == UINT32_MAX);
+    TEST_ASSERT(wgvkSelectBufferMemoryType(&props, 0, vertexUsage) == UINT32_MAX);
+}
+
+
+int main() {
+    test_discrete_without_rebar();
+    test_discrete_with_rebar();
+    test_unified_memory();
+    test_memory_type_bits_and_fallbacks();
+
+    if (g_test_failures == 0) {
+        printf("\nAll tests passed!\n");
+        return 0;
+    } else {
+        printf("\n%d test(s) failed.\n", g_test_failures);
+        return 1;
+    }
+}
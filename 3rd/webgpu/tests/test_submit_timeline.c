@@ -0,0 +1,159 @@
+// Submits many small command buffers without ever calling wgpuDeviceTick and tracks their completion
+// with wgpuQueueOnSubmittedWorkDone. Needs a Vulkan device (e.g. lavapipe):
+//   cc -I.. -I../.. test_submit_timeline.c ../wgvk.c -lm -lpthread -ldl
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <wgvk.h>
+
+static int g_test_failures = 0;
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "TEST FAILED: %s at %s:%d\n", #condition, __FILE__, __LINE__); \
+            g_test_failures++; \
+        } \
+    } while (0)
+
+#define SUBMIT_COUNT 1000
+#define WORDS 64
+
+static WGPUAdapter g_adapter;
+static WGPUDevice g_device;
+
+static void onAdapter(WGPURequestAdapterStatus status, WGPUAdapter adapter, WGPUStringView message, void* userdata1, void* userdata2) {
+    g_adapter = status == WGPURequestAdapterStatus_Success ? adapter : NULL;
+}
+static void onDevice(WGPURequestDeviceStatus status, WGPUDevice device, WGPUStringView message, void* userdata1, void* userdata2) {
+    g_device = status == WGPURequestDeviceStatus_Success ? device : NULL;
+}
+static void onWorkDone(WGPUQueueWorkDoneStatus status, void* userdata1, void* userdata2) {
+    TEST_ASSERT(status == WGPUQueueWorkDoneStatus_Success);
+    ++*(int*)userdata1;
+}
+static void onMapped(WGPUMapAsyncStatus status, WGPUStringView message, void* userdata1, void* userdata2) {
+    TEST_ASSERT(status == WGPUMapAsyncStatus_Success);
+}
+
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Ping-pongs the data between a and b SUBMIT_COUNT times, one submit per copy. Returns seconds spent in wgpuQueueSubmit
+static double pingPong(WGPUQueue queue, WGPUBuffer a, WGPUBuffer b) {
+    double inSubmit = 0;
+    for (int i = 0; i < SUBMIT_COUNT; i++) {
+        WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_device, NULL);
+        wgpuCommandEncoderCopyBufferToBuffer(encoder, (i & 1) ? b : a, 0, (i & 1) ? a : b, 0, WORDS * 4);
+        WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, NULL);
+        const double start = seconds();
+        wgpuQueueSubmit(queue, 1, &commandBuffer);
+        inSubmit += seconds() - start;
+        wgpuCommandBufferRelease(commandBuffer);
+        wgpuCommandEncoderRelease(encoder);
+    }
+    return inSubmit;
+}
+
+void test_work_done_process_events(WGPUInstance instance, WGPUQueue queue, WGPUBuffer a, WGPUBuffer b) {
+    printf("--- Running test_work_done_process_events ---\n");
+    int done = 0;
+    const double inSubmit = pingPong(queue, a, b);
+    WGPUQueueWorkDoneCallbackInfo callbackInfo = { .mode = WGPUCallbackMode_AllowProcessEvents, .callback = onWorkDone, .userdata1 = &done };
+    wgpuQueueOnSubmittedWorkDone(queue, callbackInfo);
+    for (int spins = 0; done == 0 && spins < 1000000; spins++) {
+        wgpuInstanceProcessEvents(instance);
+    }
+    TEST_ASSERT(done == 1);
+    wgpuInstanceProcessEvents(instance);
+    TEST_ASSERT(done == 1);
+    printf("%d submits: %.2f us per wgpuQueueSubmit\n", SUBMIT_COUNT, inSubmit * 1e6 / SUBMIT_COUNT);
+}
+
+void test_work_done_wait_any(WGPUInstance instance, WGPUQueue queue, WGPUBuffer a, WGPUBuffer b) {
+    printf("--- Running test_work_done_wait_any ---\n");
+    int done = 0;
+    pingPong(queue, a, b);
+    WGPUQueueWorkDoneCallbackInfo callbackInfo = { .mode = WGPUCallbackMode_WaitAnyOnly, .callback = onWorkDone, .userdata1 = &done };
+    WGPUFutureWaitInfo waitInfo = { .future = wgpuQueueOnSubmittedWorkDone(queue, callbackInfo) };
+    TEST_ASSERT(wgpuInstanceWaitAny(instance, 1, &waitInfo, UINT64_MAX) == WGPUWaitStatus_Success);
+    TEST_ASSERT(waitInfo.completed);
+    TEST_ASSERT(done == 1);
+
+    // With nothing submitted since, a second one is ready right away
+    waitInfo = (WGPUFutureWaitInfo){ .future = wgpuQueueOnSubmittedWorkDone(queue, callbackInfo) };
+    TEST_ASSERT(wgpuInstanceWaitAny(instance, 1, &waitInfo, 0) == WGPUWaitStatus_Success);
+    TEST_ASSERT(done == 2);
+}
+
+int main() {
+    WGPUInstance instance = wgpuCreateInstance(NULL);
+    if (!instance) {
+        printf("No Vulkan available, skipping\n");
+        return 0;
+    }
+    WGPURequestAdapterOptions adapterOptions = {0};
+    WGPUFutureWaitInfo adapterWait = { wgpuInstanceRequestAdapter(instance, &adapterOptions, (WGPURequestAdapterCallbackInfo){ .callback = onAdapter }) };
+    wgpuInstanceWaitAny(instance, 1, &adapterWait, UINT64_MAX);
+    if (!g_adapter) {
+        printf("No adapter available, skipping\n");
+        return 0;
+    }
+    WGPUDeviceDescriptor deviceDescriptor = {0};
+    WGPUFutureWaitInfo deviceWait = { wgpuAdapterRequestDevice(g_adapter, &deviceDescriptor, (WGPURequestDeviceCallbackInfo){ .callback = onDevice }) };
+    wgpuInstanceWaitAny(instance, 1, &deviceWait, UINT64_MAX);
+    TEST_ASSERT(g_device != NULL);
+    if (!g_device) return 1;
+    WGPUQueue queue = wgpuDeviceGetQueue(g_device);
+
+    const WGPUBufferDescriptor storageDescriptor = {
+        .size = WORDS * 4,
+        .usage = WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst,
+    };
+    WGPUBuffer a = wgpuDeviceCreateBuffer(g_device, &storageDescriptor);
+    WGPUBuffer b = wgpuDeviceCreateBuffer(g_device, &storageDescriptor);
+    uint32_t contents[WORDS];
+    for (uint32_t i = 0; i < WORDS; i++) contents[i] = i * 7;
+    wgpuQueueWriteBuffer(queue, a, 0, contents, sizeof(contents));
+
+    test_work_done_process_events(instance, queue, a, b);
+    test_work_done_wait_any(instance, queue, a, b);
+
+    // An even number of ping-pongs leaves the data in a
+    const WGPUBufferDescriptor readbackDescriptor = {
+        .size = WORDS * 4,
+        .usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst,
+    };
+    WGPUBuffer readback = wgpuDeviceCreateBuffer(g_device, &readbackDescriptor);
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_device, NULL);
+    wgpuCommandEncoderCopyBufferToBuffer(encoder, a, 0, readback, 0, WORDS * 4);
+    WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, NULL);
+    wgpuQueueSubmit(queue, 1, &commandBuffer);
+    wgpuCommandBufferRelease(commandBuffer);
+    wgpuCommandEncoderRelease(encoder);
+    WGPUBufferMapCallbackInfo mapInfo = { .mode = WGPUCallbackMode_WaitAnyOnly, .callback = onMapped };
+    WGPUFutureWaitInfo mapWait = { .future = wgpuBufferMapAsync(readback, WGPUMapMode_Read, 0, WORDS * 4, mapInfo) };
+    TEST_ASSERT(wgpuInstanceWaitAny(instance, 1, &mapWait, UINT64_MAX) == WGPUWaitStatus_Success);
+    const uint32_t* mapped = (const uint32_t*)wgpuBufferGetConstMappedRange(readback, 0, WORDS * 4);
+    TEST_ASSERT(memcmp(mapped, contents, sizeof(contents)) == 0);
+    wgpuBufferUnmap(readback);
+
+    wgpuBufferRelease(readback);
+    wgpuBufferRelease(a);
+    wgpuBufferRelease(b);
+    wgpuDeviceRelease(g_device);
+
+    if (g_test_failures == 0) {
+        printf("\nAll tests passed!\n");
+        return 0;
+    } else {
+        printf("\n%d test(s) failed.\n", g_test_failures);
+        return 1;
+    }
+}
@@ -1433,6 +1433,7 @@ WGPUInstance wgpuCreateInstance(const WGPUInstanceDescriptor* descriptor) {
     }
     ret->currentFutureId = 1;
     FutureIDMap_init(&ret->g_futureIDMap);
+    FutureIDVector_init(&ret->processEventsFutures);
     // 6. Load instance-level functions using volk
     volkLoadInstance(ret->instance);
 
@@ -1462,18 +1463,60 @@ WGPUInstance wgpuCreateInstance(const WGPUInstanceDescriptor* descriptor) {
     EXIT();
     return ret;
 }
+// Runs the future's callback if it is (or within timeoutNS becomes) ready. Returns whether it has completed
+static bool wgpuInstanceTryCompleteFuture(WGPUInstance instance, uint64_t futureID, uint64_t timeoutNS){
+    WGPUFutureImpl* futureObject = FutureIDMap_get(&instance->g_futureIDMap, futureID);
+    if(futureObject == NULL || futureObject->completed){
+        return true;
+    }
+    if(futureObject->waitReady && !futureObject->waitReady(futureObject->userdataForFunction, timeoutNS)){
+        return false;
+    }
+    // The callback may create new futures and thereby move the map's storage
+    const WGPUFutureImpl future = *futureObject;
+    futureObject->completed = true;
+    if(future.functionCalledOnWaitAny){
+        future.functionCalledOnWaitAny(future.userdataForFunction);
+    }
+    if(future.freeUserData){
+        future.freeUserData(future.userdataForFunction);
+    }
+    return true;
+}
+
+static bool wgpuInstanceCompleteReadyFutures(WGPUInstance instance, size_t futureCount, WGPUFutureWaitInfo* futureWaitInfos){
+    bool anyCompleted = false;
+    for(size_t i = 0;i < futureCount;i++){
+        if(!futureWaitInfos[i].completed && wgpuInstanceTryCompleteFuture(instance, futureWaitInfos[i].future.id, 0)){
+            futureWaitInfos[i].completed = 1;
+            anyCompleted = true;
+        }
+    }
+    return anyCompleted;
+}
+
 WGPUWaitStatus wgpuInstanceWaitAny(WGPUInstance instance, size_t futureCount, WGPUFutureWaitInfo* futureWaitInfos, uint64_t timeoutNS){
     ENTRY();
-    for(uint32_t i = 0;i < futureCount;i++){
+    if(wgpuInstanceCompleteReadyFutures(instance, futureCount, futureWaitInfos)){
+        EXIT();
+        return WGPUWaitStatus_Success;
+    }
+    if(timeoutNS == 0){
+        EXIT();
+        return WGPUWaitStatus_TimedOut;
+    }
+    // Nothing is ready yet: block on the first pending future, then pick up whatever else finished meanwhile
+    for(size_t i = 0;i < futureCount;i++){
         if(!futureWaitInfos[i].completed){
-            WGPUFutureImpl* futureObject = FutureIDMap_get(&instance->g_futureIDMap, futureWaitInfos[i].future.id);
-            futureObject->functionCalledOnWaitAny(futureObject->userdataForFunction);
-            if(futureObject->freeUserData){
-                futureObject->freeUserData(futureObject->userdataForFunction);
+            if(!wgpuInstanceTryCompleteFuture(instance, futureWaitInfos[i].future.id, timeoutNS)){
+                EXIT();
+                return WGPUWaitStatus_TimedOut;
             }
             futureWaitInfos[i].completed = 1;
+            break;
         }
     }
+    wgpuInstanceCompleteReadyFutures(instance, futureCount, futureWaitInfos);
     EXIT();
     return WGPUWaitStatus_Success;
 }
@@ -2328,9 +2371,14 @@ WGPUDevice wgpuAdapterCreateDevice(WGPUAdapter adapter, const WGPUDeviceDescript
         .samplerYcbcrConversion = requiresYCbCr ? VK_TRUE : VK_FALSE,
     };
 
+    VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+        .pNext = &accelerationStructureFeatures,
+    };
+
     VkPhysicalDeviceVulkan13Features v13features = {
         .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
-        .pNext = &accelerationStructureFeatures,
+        .pNext = &timelineSemaphoreFeatures,
     };
     
     VkPhysicalDeviceFeatures2 deviceFeatures = {
@@ -2385,6 +2433,7 @@ WGPUDevice wgpuAdapterCreateDevice(WGPUAdapter adapter, const WGPUDeviceDescript
         volkLoadDeviceTable(&retDevice->functions, retDevice->device);
         retDevice->capabilities.depthClipEnable = depthClipEnable_Found;    
         retDevice->capabilities.depthClipControl = depthClipControl_Found;    
+        retDevice->capabilities.timelineSemaphore = timelineSemaphoreFeatures.timelineSemaphore && retDevice->functions.vkGetSemaphoreCounterValue && retDevice->functions.vkWaitSemaphores;
     }
     retDevice->capabilities.dynamicRendering = v13features.dynamicRendering;
     retDevice->capabilities.raytracing = pipelineFeatures.rayTracingPipeline && accelerationStructureFeatures.accelerationStructure;
@@ -2549,6 +2598,21 @@ WGPUDevice wgpuAdapterCreateDevice(WGPUAdapter adapter, const WGPUDeviceDescript
     FIFCache_init(&retDevice->fifCache, retDevice, adapter->queueIndices.graphicsIndex);
     
     retQueue->presubmitCache = wgpuDeviceCreateCommandEncoder(retDevice, &cedesc);
+    if(retDevice->capabilities.timelineSemaphore){
+        const VkSemaphoreTypeCreateInfo stci = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+            .initialValue = 0,
+        };
+        const VkSemaphoreCreateInfo tsci = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &stci,
+        };
+        if(retDevice->functions.vkCreateSemaphore(retDevice->device, &tsci, NULL, &retQueue->timelineSemaphore) != VK_SUCCESS){
+            retDevice->capabilities.timelineSemaphore = 0;
+        }
+        PendingSubmitVector_init(&retQueue->pendingSubmits);
+    }
     VkDeviceSize limit = (((uint64_t)1) << 30);
 
     VkPhysicalDeviceMemoryProperties2 memoryProperties = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2};
@@ -2672,9 +2736,39 @@ void wgpuBufferMapSync(void* data){
     void* mapdata = NULL;
     wgpuBufferMap(info->buffer, info->mode, info->offset, info->size, &mapdata);
     
-    info->info.callback(WGPUMapAsyncStatus_Success, (WGPUStringView){"", 0}, info->info.userdata1, info->info.userdata2);
+    if(info->info.callback){
+        info->info.callback(WGPUMapAsyncStatus_Success, (WGPUStringView){"", 0}, info->info.userdata1, info->info.userdata2);
+    }
     EXIT();
 }
+
+// A map can complete once the last submit that used the buffer has finished on the GPU
+static bool wgpuQueueWaitSubmitValue(WGPUQueue queue, uint64_t value, uint64_t timeoutNS);
+static bool wgpuBufferMapReady(void* data, uint64_t timeoutNS){
+    userdataformapbufferasync* info = (userdataformapbufferasync*)data;
+    if(info->buffer->device->capabilities.timelineSemaphore){
+        return wgpuQueueWaitSubmitValue(info->buffer->device->queue, info->buffer->latestSubmitValue, timeoutNS);
+    }
+    WGPUFence fence = info->buffer->latestFence;
+    if(fence == NULL){
+        return true;
+    }
+    const WGPUFenceState state = atomic_load_explicit(&fence->state, memory_order_acquire);
+    if(state == WGPUFenceState_Finished || state == WGPUFenceState_Reset){
+        return true;
+    }
+    WGPUDevice device = info->buffer->device;
+    VkResult result = timeoutNS == 0
+        ? device->functions.vkGetFenceStatus(device->device, fence->fence)
+        : device->functions.vkWaitForFences(device->device, 1, &fence->fence, VK_TRUE, timeoutNS);
+    return result == VK_SUCCESS;
+}
+
+static void freeMapAsyncUserdata(void* data){
+    userdataformapbufferasync* info = (userdataformapbufferasync*)data;
+    wgpuBufferRelease(info->buffer);
+    RL_FREE(info);
+}
 void wgpuBufferMap(WGPUBuffer buffer, WGPUMapMode mapmode, size_t offset, size_t size, void** data);
 
 WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor* desc){
@@ -2699,27 +2793,30 @@ WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor*
     wgpuBuffer->cacheIndex = cacheIndex;
     wgpuBuffer->refCount = 1;
     wgpuBuffer->usage = desc->usage;
+    wgpuBuffer->capacity = desc->size;
     
-    
+    const bool mappable = (desc->usage & (WGPUBufferUsage_MapRead | WGPUBufferUsage_MapWrite)) != 0;
+    VkBufferUsageFlags vkUsage = toVulkanBufferUsage(desc->usage);
+    if(desc->mappedAtCreation && !mappable){
+        // Might end up in memory the host can't see, the initial contents are then copied in from a staging buffer
+        vkUsage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    }
     const VkBufferCreateInfo bufferDesc = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .size = desc->size,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-        .usage = toVulkanBufferUsage(desc->usage),
+        .usage = vkUsage,
     };
     
-    VkMemoryPropertyFlags propertyToFind = 0;
-    if(desc->usage & (WGPUBufferUsage_MapRead | WGPUBufferUsage_MapWrite)){
-        propertyToFind = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-    }
-    else{
-        // propertyToFind = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-        propertyToFind = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-    }
+    // Required when the preferred memory type (see wgvkSelectBufferMemoryType) is unavailable or full
+    const VkMemoryPropertyFlags fallbackProperties = mappable ? (VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) : 0;
+    const VkPhysicalDeviceMemoryProperties* memoryProperties = &device->builtinAllocator.memoryProperties;
 
     #if USE_VMA_ALLOCATOR == 1
+        const uint32_t preferredType = wgvkSelectBufferMemoryType(memoryProperties, ~0u, desc->usage);
         VmaAllocationCreateInfo vallocInfo = {
-            .preferredFlags = propertyToFind,
+            .requiredFlags = fallbackProperties,
+            .preferredFlags = preferredType != UINT32_MAX ? memoryProperties->memoryTypes[preferredType].propertyFlags : 0,
         };
         VmaAllocation allocation zeroinit;
         VmaAllocationInfo allocationInfo zeroinit;
@@ -2732,6 +2829,7 @@ WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor*
         }
         wgpuBuffer->vmaAllocation = allocation;
         wgpuBuffer->allocationType = AllocationTypeVMA;
+        wgpuBuffer->memoryTypeIndex = allocationInfo.memoryType;
     #else
         device->functions.vkCreateBuffer(device->device, &bufferDesc, NULL, &wgpuBuffer->buffer);
         wgvkAllocation allocation = {0};
@@ -2740,7 +2838,11 @@ WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor*
         if(desc->usage & WGPUBufferUsage_Raytracing){
             requirements.alignment = 256;
         }
-        bool ret = wgvkAllocator_alloc(&device->builtinAllocator, &requirements, propertyToFind, &allocation);
+        const uint32_t preferredType = wgvkSelectBufferMemoryType(memoryProperties, requirements.memoryTypeBits, desc->usage);
+        bool ret = wgvkAllocator_allocFromType(&device->builtinAllocator, &requirements, preferredType, &allocation);
+        if(!ret){
+            ret = wgvkAllocator_alloc(&device->builtinAllocator, &requirements, fallbackProperties, &allocation);
+        }
         if(!ret){
             // out of memory
             char errorString[1024] = {0};
@@ -2750,9 +2852,10 @@ WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor*
         }
         wgpuBuffer->allocationType = AllocationTypeBuiltin;
         wgpuBuffer->builtinAllocation = allocation;
+        wgpuBuffer->memoryTypeIndex = allocation.pool->memoryTypeIndex;
     device->functions.vkBindBufferMemory(device->device, wgpuBuffer->buffer, allocation.pool->chunks[allocation.chunk_index].memory, allocation.offset);
     #endif
-    wgpuBuffer->memoryProperties = propertyToFind;
+    wgpuBuffer->memoryProperties = memoryProperties->memoryTypes[wgpuBuffer->memoryTypeIndex].propertyFlags;
 
     if(desc->usage & WGPUBufferUsage_ShaderDeviceAddress){
         const VkBufferDeviceAddressInfo bdai = {
@@ -2762,10 +2865,20 @@ WGPUBuffer wgpuDeviceCreateBuffer(WGPUDevice device, const WGPUBufferDescriptor*
         wgpuBuffer->address = device->functions.vkGetBufferDeviceAddress(device->device, &bdai);
     }
     if(desc->mappedAtCreation){
-        // TODO
         void* mapData = NULL;
-        wgpuBufferMap(wgpuBuffer, (desc->usage & WGPUBufferUsage_MapWrite) ? WGPUMapMode_Write : WGPUMapMode_Read, 0, desc->size, &mapData);
-
+        if(wgpuBuffer->memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT){
+            wgpuBufferMap(wgpuBuffer, (desc->usage & WGPUBufferUsage_MapWrite) ? WGPUMapMode_Write : WGPUMapMode_Read, 0, desc->size, &mapData);
+        }
+        else{
+            // Hand out a staging buffer instead, wgpuBufferUnmap copies it over
+            WGPUBufferDescriptor stagingDesc zeroinit;
+            stagingDesc.size = desc->size;
+            stagingDesc.usage = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+            wgpuBuffer->mappedAtCreationStaging = wgpuDeviceCreateBuffer(device, &stagingDesc);
+            wgpuBufferMap(wgpuBuffer->mappedAtCreationStaging, WGPUMapMode_Write, 0, desc->size, &mapData);
+            wgpuBuffer->mappedRange = mapData;
+            wgpuBuffer->mapState = WGPUBufferMapState_Mapped;
+        }
     }
     return wgpuBuffer;
     EXIT();
@@ -2777,6 +2890,9 @@ void wgpuBufferMap(WGPUBuffer buffer, WGPUMapMode mapmode, size_t offset, size_t
     if(size == WGPU_WHOLE_SIZE){
         size = wgpuBufferGetSize(buffer);
     }
+    if(device->capabilities.timelineSemaphore){
+        wgpuQueueWaitSubmitValue(device->queue, buffer->latestSubmitValue, UINT64_MAX);
+    }
     if(buffer->latestFence){
         if(buffer->latestFence->state == WGPUFenceState_InUse){
             wgpuFenceWait(buffer->latestFence, ((uint64_t)1) << 40);
@@ -2819,6 +2935,15 @@ void wgpuBufferUnmap(WGPUBuffer buffer){
     WGPUDevice device = buffer->device;
     buffer->mappedRange = NULL;
     buffer->mapState = WGPUBufferMapState_Unmapped;
+    if(buffer->mappedAtCreationStaging){
+        WGPUBuffer staging = buffer->mappedAtCreationStaging;
+        buffer->mappedAtCreationStaging = NULL;
+        wgpuBufferUnmap(staging);
+        wgpuCommandEncoderCopyBufferToBuffer(device->queue->presubmitCache, staging, 0, buffer, 0, buffer->capacity);
+        wgpuBufferRelease(staging);
+        EXIT();
+        return;
+    }
     switch(buffer->allocationType){
         case AllocationTypeBuiltin:{
             wgvkAllocation* allocation = &buffer->builtinAllocation;
@@ -2850,13 +2975,21 @@ WGPUFuture wgpuBufferMapAsync(WGPUBuffer buffer, WGPUMapMode mode, size_t offset
     info->offset = offset;
     info->size = size;
     info->info = callbackInfo;
+    wgpuBufferAddRef(buffer);
+    buffer->mapState = WGPUBufferMapState_Pending;
     WGPUFutureImpl ret = {
         .userdataForFunction = info,
         .functionCalledOnWaitAny = wgpuBufferMapSync,
-        .freeUserData = RL_FREE
+        .freeUserData = freeMapAsyncUserdata,
+        .waitReady = wgpuBufferMapReady,
+        .callbackMode = callbackInfo.mode,
     };
-    uint64_t id = atomic_fetch_add_explicit(&buffer->device->adapter->instance->currentFutureId, 1, memory_order_relaxed);
-    FutureIDMap_put(&buffer->device->adapter->instance->g_futureIDMap, id, ret);
+    WGPUInstance instance = buffer->device->adapter->instance;
+    uint64_t id = atomic_fetch_add_explicit(&instance->currentFutureId, 1, memory_order_relaxed);
+    FutureIDMap_put(&instance->g_futureIDMap, id, ret);
+    if(callbackInfo.mode == WGPUCallbackMode_AllowProcessEvents || callbackInfo.mode == WGPUCallbackMode_AllowSpontaneous){
+        FutureIDVector_push_back(&instance->processEventsFutures, id);
+    }
     return (WGPUFuture){ id };
     EXIT();
 }
@@ -2901,9 +3034,9 @@ void wgpuQueueWriteBuffer(WGPUQueue cSelf, WGPUBuffer buffer, uint64_t bufferOff
     else{
         WGPUBufferDescriptor stDesc zeroinit;
         stDesc.size = size;
-        stDesc.usage = WGPUBufferUsage_MapWrite;
+        stDesc.usage = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
         WGPUBuffer stagingBuffer = wgpuDeviceCreateBuffer(cSelf->device, &stDesc);
-        wgpuQueueWriteBuffer(cSelf, stagingBuffer, bufferOffset, data, size);
+        wgpuQueueWriteBuffer(cSelf, stagingBuffer, 0, data, size);
         wgpuCommandEncoderCopyBufferToBuffer(cSelf->presubmitCache, stagingBuffer, 0, buffer, bufferOffset, size);
         wgpuBufferRelease(stagingBuffer);
     }
@@ -5130,6 +5263,63 @@ void releaseCommandBuffersDependingOnFence(void* userdata){
     }
     WGPUCommandBufferVector_free(bufferVector);
 }
+static uint64_t wgpuQueueGetCompletedValue(WGPUQueue queue){
+    if(queue->completedValue < queue->lastSubmittedValue){
+        uint64_t value = 0;
+        if(queue->device->functions.vkGetSemaphoreCounterValue(queue->device->device, queue->timelineSemaphore, &value) == VK_SUCCESS){
+            queue->completedValue = value;
+        }
+    }
+    return queue->completedValue;
+}
+
+static bool wgpuQueueWaitSubmitValue(WGPUQueue queue, uint64_t value, uint64_t timeoutNS){
+    if(wgpuQueueGetCompletedValue(queue) >= value){
+        return true;
+    }
+    if(timeoutNS == 0){
+        return false;
+    }
+    const VkSemaphoreWaitInfo waitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+        .semaphoreCount = 1,
+        .pSemaphores = &queue->timelineSemaphore,
+        .pValues = &value,
+    };
+    VkResult waitResult = queue->device->functions.vkWaitSemaphores(queue->device->device, &waitInfo, timeoutNS);
+    wgvk_assert(waitResult == VK_SUCCESS || waitResult == VK_TIMEOUT, "vkWaitSemaphores returned an unexpected error.");
+    if(waitResult != VK_SUCCESS){
+        return false;
+    }
+    if(queue->completedValue < value){
+        queue->completedValue = value;
+    }
+    return true;
+}
+
+// Releases the command buffers (and with them all referenced resources) of every submit the GPU has finished.
+// pendingSubmits is ordered by value, so this only ever pops a prefix.
+static void wgpuQueueReleaseCompletedSubmits(WGPUQueue queue){
+    PendingSubmitVector* pending = &queue->pendingSubmits;
+    if(pending->size == 0){
+        return;
+    }
+    const uint64_t completed = wgpuQueueGetCompletedValue(queue);
+    size_t done = 0;
+    while(done < pending->size && pending->data[done].value <= completed){
+        WGPUCommandBufferVector* buffers = &pending->data[done].commandBuffers;
+        for(size_t i = 0;i < buffers->size;i++){
+            wgpuCommandBufferRelease(buffers->data[i]);
+        }
+        WGPUCommandBufferVector_free(buffers);
+        ++done;
+    }
+    if(done > 0){
+        memmove(pending->data, pending->data + done, (pending->size - done) * sizeof(PendingSubmit));
+        pending->size -= done;
+    }
+}
+
 void wgpuQueueWaitIdle(WGPUQueue queue){
     ENTRY();
     queue->device->functions.vkQueueWaitIdle(queue->graphicsQueue);
@@ -5192,7 +5382,8 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
         submittableWGPU.data[i + cacheBufferNonEmpty] = buffers[i];
     }
 
-    WGPUFence fence = wgpuDeviceCreateFence(queue->device);
+    const bool useTimeline = queue->device->capabilities.timelineSemaphore;
+    WGPUFence fence = useTimeline ? NULL : wgpuDeviceCreateFence(queue->device);
 
 
     const uint64_t frameCount = queue->device->submittedFrames;
@@ -5243,7 +5434,12 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
             syncState->acquireImageSemaphoreSignalled = false;
         }
         const uint32_t submits = syncState->submits;
-        if(submits > 0){
+        if(useTimeline){
+            if(queue->lastSubmittedValue > 0){
+                VkSemaphoreVector_push_back(&waitSemaphores, queue->timelineSemaphore);
+            }
+        }
+        else if(submits > 0){
             VkSemaphoreVector_push_back(&waitSemaphores, syncState->semaphores.data[submits]);
         }
         VkPipelineStageFlags* waitFlags = (VkPipelineStageFlags*)RL_CALLOC(waitSemaphores.size, sizeof(VkPipelineStageFlags));
@@ -5257,7 +5453,7 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
             VkCommandBufferVector_push_back(&finalSubmittable, interspersedBuffers.data[i]->buffer);
             VkCommandBufferVector_push_back(&finalSubmittable, submittableWGPU.data[i]->buffer);
         }
-        const VkSubmitInfo submitInfo = {
+        VkSubmitInfo submitInfo = {
             .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
             .commandBufferCount = finalSubmittable.size,
             .waitSemaphoreCount = waitSemaphores.size,
@@ -5267,6 +5463,21 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
             .pSignalSemaphores = syncState->semaphores.data + submits + 1,
             .pCommandBuffers = finalSubmittable.data,
         };
+        // Timeline path: wait for the previous submit's value instead of the binary chain and signal the next one.
+        // Values for binary semaphores in the wait list (the acquire semaphore) are ignored.
+        const uint64_t signalValue = queue->lastSubmittedValue + 1;
+        uint64_t waitValues[2] = {queue->lastSubmittedValue, queue->lastSubmittedValue};
+        const VkTimelineSemaphoreSubmitInfo timelineInfo = {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+            .waitSemaphoreValueCount = waitSemaphores.size,
+            .pWaitSemaphoreValues = waitValues,
+            .signalSemaphoreValueCount = 1,
+            .pSignalSemaphoreValues = &signalValue,
+        };
+        if(useTimeline){
+            submitInfo.pNext = &timelineInfo;
+            submitInfo.pSignalSemaphores = &queue->timelineSemaphore;
+        }
         if(finalSubmittable.size){
             //printf("Submitting:\n");
             //for(uint32_t i = 0;i < finalSubmittable.size;i++){
@@ -5274,11 +5485,16 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
             //}
             //printf("with fence %p\n", fence);
         }
-        ++syncState->submits;
         WGPUFence submitFence = fence;
         submitResult = queue->device->functions.vkQueueSubmit(queue->graphicsQueue, 1, &submitInfo, submitFence ? submitFence->fence : VK_NULL_HANDLE);
         if(submitResult == VK_SUCCESS){
-            submitFence->state = WGPUFenceState_InUse;
+            if(useTimeline){
+                queue->lastSubmittedValue = signalValue;
+            }
+            else{
+                ++syncState->submits;
+                submitFence->state = WGPUFenceState_InUse;
+            }
         }
         for(uint32_t i = 0;i < submittableWGPU.size;i++){
             ImageUsageRecordMap_for_each(&interspersedBuffers.data[i]->resourceUsage.referencedTextures, updateLayoutCallback, NULL);
@@ -5307,6 +5523,10 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
                 // However it is possible all buffers are allocated with the HOST_VISIBLE bit
                 // Also everWrittenTo is currently always set to true
                 if((kv_pair->key != PHM_DELETED_SLOT_KEY && kv_pair->key != PHM_EMPTY_SLOT_KEY) /*&& kv_pair->value.everWrittenTo != VK_FALSE && (keybuffer->usage & (WGPUBufferUsage_MapWrite | WGPUBufferUsage_MapRead))*/){
+                    if(useTimeline){
+                        keybuffer->latestSubmitValue = queue->lastSubmittedValue;
+                        continue;
+                    }
                     if(keybuffer->latestFence)
                         wgpuFenceRelease(keybuffer->latestFence);
                     keybuffer->latestFence = fence;
@@ -5334,7 +5554,19 @@ void wgpuQueueSubmit(WGPUQueue queue, size_t commandCount, const WGPUCommandBuff
             WGPUCommandBufferVector_push_back(&insert, interspersedBuffers.data[i]);
         }
 
-        PerframeCache_pushFenceDependencies(perFrameCache, fence, &insert);
+        if(useTimeline){
+            for(size_t i = 0;i < insert.size;i++){
+                wgpuCommandBufferAddRef(insert.data[i]);
+            }
+            PendingSubmitVector_push_back(&queue->pendingSubmits, (PendingSubmit){
+                .value = queue->lastSubmittedValue,
+                .commandBuffers = insert,
+            });
+            wgpuQueueReleaseCompletedSubmits(queue);
+        }
+        else{
+            PerframeCache_pushFenceDependencies(perFrameCache, fence, &insert);
+        }
 
         for(size_t i = 0;i < interspersedBuffers.size;i++){
             wgpuCommandBufferRelease(interspersedBuffers.data[i]);
@@ -6008,6 +6240,9 @@ void wgpuBufferRelease(WGPUBuffer buffer) {
             wgpuFenceRelease(buffer->latestFence);
             buffer->latestFence = NULL;
         }
+        if(buffer->mappedAtCreationStaging){
+            wgpuBufferRelease(buffer->mappedAtCreationStaging);
+        }
         switch(buffer->allocationType){
             #if USE_VMA_ALLOCATOR
             case AllocationTypeVMA:
@@ -6118,6 +6353,7 @@ void wgpuInstanceRelease                      (WGPUInstance instance){
         vkDestroyDebugUtilsMessengerEXT(instance->instance, instance->debugMessenger, NULL);
         vkDestroyInstance(instance->instance, NULL);
         FutureIDMap_free(&instance->g_futureIDMap);
+        FutureIDVector_free(&instance->processEventsFutures);
         RL_FREE(instance);
     }
     EXIT();
@@ -6145,6 +6381,13 @@ void wgpuDeviceRelease(WGPUDevice device){
         WGPUCommandBuffer cBuffer = wgpuCommandEncoderFinish(device->queue->presubmitCache, &cbd);
         wgpuCommandEncoderRelease(device->queue->presubmitCache);
         wgpuCommandBufferRelease(cBuffer);
+        if(device->capabilities.timelineSemaphore){
+            WGPUQueue queue = device->queue;
+            wgpuQueueWaitSubmitValue(queue, queue->lastSubmittedValue, UINT64_MAX);
+            wgpuQueueReleaseCompletedSubmits(queue);
+            PendingSubmitVector_free(&queue->pendingSubmits);
+            device->functions.vkDestroySemaphore(device->device, queue->timelineSemaphore, NULL);
+        }
         FIFCache_destroy(&device->fifCache);
         {  // Destroy PerframeCaches
             
@@ -7449,6 +7692,9 @@ void wgpuDeviceTick(WGPUDevice device){
 
     PendingCommandBufferMap_for_each(pcmNew, resetFenceAndReleaseBuffers, device);    
     WGPUFenceVector_free(&fences);
+    if(device->capabilities.timelineSemaphore){
+        wgpuQueueReleaseCompletedSubmits(device->queue);
+    }
 
     WGPUBufferVector* usedBuffers = &frameCacheMew->usedBatchBuffers;
     WGPUBufferVector* unusedBuffers = &frameCacheMew->unusedBatchBuffers;
@@ -8698,6 +8944,12 @@ WGPUBufferUsage wgpuBufferGetUsage(WGPUBuffer buffer) {
     EXIT();
     return buffer->usage;
 }
+uint32_t wgpuBufferGetMemoryTypeIndex(WGPUBuffer buffer) {
+    return buffer->memoryTypeIndex;
+}
+uint32_t wgpuBufferGetMemoryHeapIndex(WGPUBuffer buffer) {
+    return buffer->device->builtinAllocator.memoryProperties.memoryTypes[buffer->memoryTypeIndex].heapIndex;
+}
 WGPUStatus wgpuBufferReadMappedRange(WGPUBuffer buffer, size_t offset, void * data, size_t size) {
     ENTRY();
     EXIT();
@@ -9241,7 +9493,18 @@ WGPUBool wgpuInstanceHasWGSLLanguageFeature(WGPUInstance instance, WGPUWGSLLangu
     return 0;
 }
 void wgpuInstanceProcessEvents(WGPUInstance instance) {
-    ENTRY()
+    ENTRY();
+    // Completes whatever is ready without blocking, keeps the rest for the next call
+    FutureIDVector* pending = &instance->processEventsFutures;
+    size_t kept = 0;
+    for(size_t i = 0;i < pending->size;i++){
+        const uint64_t id = pending->data[i];
+        // Callbacks may queue new futures, which land behind i and are visited by this loop as well
+        if(!wgpuInstanceTryCompleteFuture(instance, id, 0)){
+            pending->data[kept++] = id;
+        }
+    }
+    pending->size = kept;
     EXIT();
 }
 
@@ -9284,9 +9547,36 @@ void wgpuQuerySetRelease(WGPUQuerySet querySet) {
 }
 
 
+static bool workDoneFutureReady(void* userdata, uint64_t timeoutNS) {
+    WorkDoneFutureState* state = (WorkDoneFutureState*)userdata;
+    if (!state->fence) {
+        return wgpuQueueWaitSubmitValue(state->queue, state->submitValue, timeoutNS);
+    }
+    const WGPUFenceState fenceState = atomic_load_explicit(&state->fence->state, memory_order_acquire);
+    if (fenceState == WGPUFenceState_Finished) {
+        return true;
+    }
+    WGPUDevice device = state->device;
+    VkResult result = timeoutNS == 0
+        ? device->functions.vkGetFenceStatus(device->device, state->fence->fence)
+        : device->functions.vkWaitForFences(device->device, 1, &state->fence->fence, VK_TRUE, timeoutNS);
+    return result == VK_SUCCESS;
+}
+
 static void processWorkDoneFuture(void* userdata) {
     WorkDoneFutureState* state = (WorkDoneFutureState*)userdata;
 
+    if (!state->fence) {
+        wgpuQueueWaitSubmitValue(state->queue, state->submitValue, UINT64_MAX);
+        wgpuQueueReleaseCompletedSubmits(state->queue);
+        if (state->callbackInfo.callback) {
+            state->callbackInfo.callback(WGPUQueueWorkDoneStatus_Success, 
+                                         state->callbackInfo.userdata1, 
+                                         state->callbackInfo.userdata2);
+        }
+        return;
+    }
+
     wgpuFenceWait(state->fence, UINT64_MAX);
 
     WGPUFenceState finalState = atomic_load_explicit(&state->fence->state, memory_order_acquire);
@@ -9311,7 +9601,9 @@ static void freeWorkDoneFutureState(void* userdata) {
     if (!userdata) return;
     WorkDoneFutureState* state = (WorkDoneFutureState*)userdata;
     
-    wgpuFenceRelease(state->fence);
+    if (state->fence) {
+        wgpuFenceRelease(state->fence);
+    }
     
     RL_FREE(state);
 }
@@ -9319,6 +9611,30 @@ static void freeWorkDoneFutureState(void* userdata) {
 // The main implementation
 WGPUFuture wgpuQueueOnSubmittedWorkDone(WGPUQueue queue, WGPUQueueWorkDoneCallbackInfo callbackInfo) {
     ENTRY();
+    WGPUInstance instance = queue->device->adapter->instance;
+
+    if (queue->device->capabilities.timelineSemaphore) {
+        // Everything submitted so far is done once the timeline reaches the last submitted value, no extra submit needed
+        WorkDoneFutureState* futureState = RL_CALLOC(1, sizeof(WorkDoneFutureState));
+        futureState->queue = queue;
+        futureState->submitValue = queue->lastSubmittedValue;
+        futureState->callbackInfo = callbackInfo;
+        futureState->device = queue->device;
+        WGPUFutureImpl futureImpl = {
+            .userdataForFunction = futureState,
+            .functionCalledOnWaitAny = processWorkDoneFuture,
+            .freeUserData = freeWorkDoneFutureState,
+            .waitReady = workDoneFutureReady,
+            .callbackMode = callbackInfo.mode,
+        };
+        uint64_t futureID = atomic_fetch_add_explicit(&instance->currentFutureId, 1, memory_order_relaxed);
+        FutureIDMap_put(&instance->g_futureIDMap, futureID, futureImpl);
+        if (callbackInfo.mode == WGPUCallbackMode_AllowProcessEvents || callbackInfo.mode == WGPUCallbackMode_AllowSpontaneous) {
+            FutureIDVector_push_back(&instance->processEventsFutures, futureID);
+        }
+        EXIT();
+        return (WGPUFuture){ .id = futureID };
+    }
 
     WGPUFence fence = wgpuDeviceCreateFence(queue->device);
     if (!fence) {
@@ -9356,15 +9672,19 @@ WGPUFuture wgpuQueueOnSubmittedWorkDone(WGPUQueue queue, WGPUQueueWorkDoneCallba
     futureState->device = queue->device;
 
     // 4. Create and register the WGPUFuture.
-    WGPUInstance instance = queue->device->adapter->instance;
     WGPUFutureImpl futureImpl = {
         .userdataForFunction = futureState,
         .functionCalledOnWaitAny = processWorkDoneFuture,
-        .freeUserData = freeWorkDoneFutureState
+        .freeUserData = freeWorkDoneFutureState,
+        .waitReady = workDoneFutureReady,
+        .callbackMode = callbackInfo.mode,
     };
     
     uint64_t futureID = atomic_fetch_add_explicit(&instance->currentFutureId, 1, memory_order_relaxed);
     FutureIDMap_put(&instance->g_futureIDMap, futureID, futureImpl);
+    if (callbackInfo.mode == WGPUCallbackMode_AllowProcessEvents || callbackInfo.mode == WGPUCallbackMode_AllowSpontaneous) {
+        FutureIDVector_push_back(&instance->processEventsFutures, futureID);
+    }
     
     EXIT();
     return (WGPUFuture){ .id = futureID };
@@ -9924,6 +10244,10 @@ RGAPI VkResult wgvkAllocator_init(WgvkAllocator* allocator, VkPhysicalDevice phy
     allocator->physicalDevice = physicalDevice;
     allocator->pFunctions = dtable;
     vkGetPhysicalDeviceMemoryProperties(physicalDevice, &allocator->memoryProperties);
+    // At most one pool per memory type. Allocations keep pointers to their pool, so this array must never move
+    allocator->pool_capacity = allocator->memoryProperties.memoryTypeCount;
+    allocator->pools = RL_CALLOC(allocator->pool_capacity ? allocator->pool_capacity : 1, sizeof(WgvkDeviceMemoryPool));
+    if (!allocator->pools) return VK_ERROR_OUT_OF_HOST_MEMORY;
     return VK_SUCCESS;
 }
 
@@ -9936,71 +10260,54 @@ RGAPI void wgvkAllocator_destroy(WgvkAllocator* allocator) {
     memset(allocator, 0, sizeof(WgvkAllocator));
 }
 
-RGAPI bool wgvkAllocator_alloc(WgvkAllocator* allocator, const VkMemoryRequirements* requirements, VkMemoryPropertyFlags propertyFlags, wgvkAllocation* out_allocation) {
-    // Normalized alignment used everywhere below.
-    size_t norm_alignment = requirements->alignment;
-    {
-        size_t min_align = ALLOCATOR_GRANULARITY;
-        if (norm_alignment < min_align) norm_alignment = min_align;
-        size_t a = norm_alignment - 1;
-        a |= a >> 1;
-        a |= a >> 2;
-        a |= a >> 4;
-        a |= a >> 8;
-        a |= a >> 16;
-#if SIZE_MAX > 0xFFFFFFFFu
-        a |= a >> 32;
-#endif
-        norm_alignment = a + 1;
-    }
-
-    for (uint32_t i = 0; i < allocator->memoryProperties.memoryTypeCount; ++i) {
-        if (!((requirements->memoryTypeBits >> i) & 1)) continue;
-        if ((allocator->memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) != propertyFlags) continue;
-
-        WgvkDeviceMemoryPool* found_pool = NULL;
-        for (uint32_t j = 0; j < allocator->pool_count; ++j) {
-            if (allocator->pools[j].memoryTypeIndex == i) {
-                found_pool = &allocator->pools[j];
-                break;
-            }
-        }
-
-        if (found_pool) {
-            if (wgvkDeviceMemoryPool_alloc(found_pool, requirements->size, norm_alignment, out_allocation)) {
-                return true;
-            }
+static WgvkDeviceMemoryPool* wgvkAllocator_getPool(WgvkAllocator* allocator, uint32_t memoryTypeIndex) {
+    for (uint32_t j = 0; j < allocator->pool_count; ++j) {
+        if (allocator->pools[j].memoryTypeIndex == memoryTypeIndex) {
+            return &allocator->pools[j];
         }
     }
+    if (allocator->pool_count == allocator->pool_capacity) return NULL;
 
-    for (uint32_t i = 0; i < allocator->memoryProperties.memoryTypeCount; ++i) {
-        if (!((requirements->memoryTypeBits >> i) & 1)) continue;
-        if ((allocator->memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) != propertyFlags) continue;
+    WgvkDeviceMemoryPool* new_pool = &allocator->pools[allocator->pool_count++];
+    memset(new_pool, 0, sizeof(WgvkDeviceMemoryPool));
+    new_pool->device = allocator->device;
+    new_pool->physicalDevice = allocator->physicalDevice;
+    new_pool->memoryTypeIndex = memoryTypeIndex;
+    new_pool->pFunctions = allocator->pFunctions;
+    return new_pool;
+}
 
-        if (allocator->pool_count == allocator->pool_capacity) {
-            uint32_t new_capacity = allocator->pool_capacity == 0 ? 4 : allocator->pool_capacity * 2;
-            WgvkDeviceMemoryPool* new_pools = RL_REALLOC(allocator->pools, new_capacity * sizeof(WgvkDeviceMemoryPool));
-            if (!new_pools) return false;
-            allocator->pools = new_pools;
-            allocator->pool_capacity = new_capacity;
-        }
+static size_t wgvkAllocator_normalizeAlignment(size_t alignment) {
+    size_t min_align = ALLOCATOR_GRANULARITY;
+    if (alignment < min_align) alignment = min_align;
+    size_t a = alignment - 1;
+    a |= a >> 1;
+    a |= a >> 2;
+    a |= a >> 4;
+    a |= a >> 8;
+    a |= a >> 16;
+#if SIZE_MAX > 0xFFFFFFFFu
+    a |= a >> 32;
+#endif
+    return a + 1;
+}
 
-        WgvkDeviceMemoryPool* new_pool = &allocator->pools[allocator->pool_count];
-        memset(new_pool, 0, sizeof(WgvkDeviceMemoryPool));
-        new_pool->device = allocator->device;
-        new_pool->physicalDevice = allocator->physicalDevice;
-        new_pool->memoryTypeIndex = i;
-        new_pool->pFunctions = allocator->pFunctions;
+RGAPI bool wgvkAllocator_allocFromType(WgvkAllocator* allocator, const VkMemoryRequirements* requirements, uint32_t memoryTypeIndex, wgvkAllocation* out_allocation) {
+    if (memoryTypeIndex >= allocator->memoryProperties.memoryTypeCount) return false;
+    if (!((requirements->memoryTypeBits >> memoryTypeIndex) & 1)) return false;
 
-        allocator->pool_count++;
+    WgvkDeviceMemoryPool* pool = wgvkAllocator_getPool(allocator, memoryTypeIndex);
+    if (!pool) return false;
+    return wgvkDeviceMemoryPool_alloc(pool, requirements->size, wgvkAllocator_normalizeAlignment(requirements->alignment), out_allocation);
+}
 
-        if (wgvkDeviceMemoryPool_alloc(new_pool, requirements->size, norm_alignment, out_allocation)) {
+RGAPI bool wgvkAllocator_alloc(WgvkAllocator* allocator, const VkMemoryRequirements* requirements, VkMemoryPropertyFlags propertyFlags, wgvkAllocation* out_allocation) {
+    for (uint32_t i = 0; i < allocator->memoryProperties.memoryTypeCount; ++i) {
+        if ((allocator->memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) != propertyFlags) continue;
+        if (wgvkAllocator_allocFromType(allocator, requirements, i, out_allocation)) {
             return true;
-        } else {
-            allocator->pool_count--;
         }
     }
-
     return false;
 }
 
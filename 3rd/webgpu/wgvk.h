@@ -1966,6 +1966,9 @@ WGVK_EXPORT void wgpuBufferUnmap(WGPUBuffer buffer);
 
 WGVK_EXPORT WGPUFuture wgpuBufferMapAsync(WGPUBuffer buffer, WGPUMapMode mode, size_t offset, size_t size, WGPUBufferMapCallbackInfo callbackInfo);
 WGVK_EXPORT size_t wgpuBufferGetSize(WGPUBuffer buffer);
+// Vulkan memory type / heap the buffer was placed in, mainly for tests and diagnostics
+WGVK_EXPORT uint32_t wgpuBufferGetMemoryTypeIndex(WGPUBuffer buffer);
+WGVK_EXPORT uint32_t wgpuBufferGetMemoryHeapIndex(WGPUBuffer buffer);
 WGVK_EXPORT void wgpuQueueWriteTexture(WGPUQueue queue, WGPUTexelCopyTextureInfo const * destination, const void* data, size_t dataSize, WGPUTexelCopyBufferLayout const * dataLayout, WGPUExtent3D const * writeSize);
 
 WGVK_EXPORT WGPUFence wgpuDeviceCreateFence                      (WGPUDevice device);
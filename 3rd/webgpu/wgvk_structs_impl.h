@@ -1371,6 +1371,7 @@ typedef struct wgvkAllocation {
 RGAPI VkResult wgvkAllocator_init(WgvkAllocator* allocator, VkPhysicalDevice physicalDevice, WGPUDevice device, struct VolkDeviceTable* pFunctions);
 RGAPI void wgvkAllocator_destroy(WgvkAllocator* allocator);
 RGAPI bool wgvkAllocator_alloc(WgvkAllocator* allocator, const VkMemoryRequirements* requirements, VkMemoryPropertyFlags propertyFlags, wgvkAllocation* out_allocation);
+RGAPI bool wgvkAllocator_allocFromType(WgvkAllocator* allocator, const VkMemoryRequirements* requirements, uint32_t memoryTypeIndex, wgvkAllocation* out_allocation);
 RGAPI void wgvkAllocator_free(const wgvkAllocation* allocation);
 
 // =======================================================================
@@ -1682,6 +1683,13 @@ DEFINE_VECTOR (CONTAINERAPI, RenderPassCommandGeneric, RenderPassCommandGenericV
 DEFINE_VECTOR (CONTAINERAPI, VkSemaphore, VkSemaphoreVector)
 DEFINE_VECTOR (CONTAINERAPI, WGPUCommandBuffer, WGPUCommandBufferVector)
 DEFINE_VECTOR (CONTAINERAPI, WGPUCommandEncoder, WGPUCommandEncoderVector)
+
+// Command buffers kept alive until the queue's timeline semaphore reaches value
+typedef struct PendingSubmit{
+    uint64_t value;
+    WGPUCommandBufferVector commandBuffers;
+}PendingSubmit;
+DEFINE_VECTOR (static inline, PendingSubmit, PendingSubmitVector)
 DEFINE_VECTOR (CONTAINERAPI, VkDescriptorBufferInfo, VkDescriptorBufferInfoVector)
 DEFINE_VECTOR (CONTAINERAPI, VkDescriptorImageInfo, VkDescriptorImageInfoVector)
 DEFINE_VECTOR (CONTAINERAPI, VkWriteDescriptorSetAccelerationStructureKHR, VkWriteDescriptorSetAccelerationStructureKHRVector)
@@ -1995,7 +2003,9 @@ typedef enum WGPUFenceState {
 } WGPUFenceState;
 
 typedef struct WorkDoneFutureState {
-    WGPUFence fence;                             // The fence tracking the work completion.
+    WGPUFence fence;                             // The fence tracking the work completion, NULL with timeline semaphores.
+    WGPUQueue queue;
+    uint64_t submitValue;                        // Timeline value to wait for if fence is NULL.
     WGPUQueueWorkDoneCallbackInfo callbackInfo;  // The user's callback and data.
     WGPUDevice device;                           // The device context.
 } WorkDoneFutureState;
@@ -2069,9 +2079,12 @@ typedef struct WGPUBufferImpl{
         VkDeviceMemory justMemory;
     };
     VkMemoryPropertyFlags memoryProperties;
+    uint32_t memoryTypeIndex;
     VkDeviceAddress address; //uint64_t, if applicable (BufferUsage_ShaderDeviceAddress)
     refcount_type refCount;
     WGPUFence latestFence;
+    uint64_t latestSubmitValue; // Timeline value of the last submit using this buffer, replaces latestFence if the device has timeline semaphores
+    WGPUBuffer mappedAtCreationStaging; // Holds the mapped data of a non host visible buffer until the first unmap
 }WGPUBufferImpl;
 
 typedef struct WGPURayTracingShaderBindingTableImpl{
@@ -2127,10 +2140,16 @@ typedef struct WGPUFutureImpl{
     void* userdataForFunction;
     void (*functionCalledOnWaitAny)(void*);
     void (*freeUserData)(void*);
+    // Optional: returns true once functionCalledOnWaitAny can run without blocking, waiting at most timeoutNS for that.
+    // Futures without it are completed by calling functionCalledOnWaitAny right away
+    bool (*waitReady)(void*, uint64_t timeoutNS);
+    WGPUCallbackMode callbackMode;
+    bool completed;
 }WGPUFutureImpl;
 
 DEFINE_GENERIC_HASH_MAP(CONTAINERAPI, RenderPassCache, RenderPassLayout, LayoutedRenderPass, renderPassLayoutHash, renderPassLayoutCompare, CLITERAL(RenderPassLayout){0});
 DEFINE_GENERIC_HASH_MAP(static inline, FutureIDMap, uint64_t, WGPUFutureImpl, identity_sdf, comparison_sdf, 0);
+DEFINE_VECTOR(static inline, uint64_t, FutureIDVector);
 
 
 typedef struct WGPUInstanceImpl{
@@ -2140,6 +2159,7 @@ typedef struct WGPUInstanceImpl{
 
     Atomar(uint64_t) currentFutureId;
     FutureIDMap g_futureIDMap;
+    FutureIDVector processEventsFutures; // Pollable futures that wgpuInstanceProcessEvents may complete
 }WGPUInstanceImpl;
 
 
@@ -2201,6 +2221,7 @@ typedef struct WGVKCapabilities{
     WGPUBool dynamicRendering;
     WGPUBool depthClipEnable;
     WGPUBool depthClipControl;
+    WGPUBool timelineSemaphore;
 }WGVKCapabilities;
 
 typedef struct FIFCache{
@@ -2655,7 +2676,12 @@ typedef struct WGPUQueueImpl{
 
     WGPUCommandEncoder presubmitCache;
 
-    
+    // Only used if device->capabilities.timelineSemaphore:
+    // every submit signals ++lastSubmittedValue, resources stay alive in pendingSubmits until completedValue reaches it
+    VkSemaphore timelineSemaphore;
+    uint64_t lastSubmittedValue;
+    uint64_t completedValue;
+    PendingSubmitVector pendingSubmits;
 }WGPUQueueImpl;
 
 
@@ -3133,6 +3159,64 @@ static inline VkBufferUsageFlags toVulkanBufferUsage(WGPUBufferUsage busg) {
     return usage;
 }
 
+/**
+ * @brief Picks the memory type a buffer with the given usage should live in.
+ *
+ * Candidates are tried in order of preference, the first memory type allowed by
+ * memoryTypeBits that has all required and none of the avoided flags wins:
+ *  - MapRead:  host visible and coherent, preferably cached since the CPU reads it
+ *  - MapWrite: host visible and coherent, preferably outside of device local memory
+ *              to leave the (Re)BAR window to buffers that benefit from it
+ *  - Uniform:  device local and host visible (ReBAR or UMA) so that queue writes are a plain memcpy,
+ *              otherwise device local and written through a staging copy
+ *  - others:   device local, preferably not host visible, written through a staging copy
+ *
+ * Mappable buffers are only ever placed in host coherent memory since mapping never flushes or invalidates.
+ *
+ * @return The memory type index, or UINT32_MAX if no memory type is suitable
+ */
+static inline uint32_t wgvkSelectBufferMemoryType(const VkPhysicalDeviceMemoryProperties* memoryProperties, uint32_t memoryTypeBits, WGPUBufferUsage usage) {
+    const VkMemoryPropertyFlags hostMappable = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    const VkMemoryPropertyFlags neverUse = VK_MEMORY_PROPERTY_PROTECTED_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+    struct {
+        VkMemoryPropertyFlags required;
+        VkMemoryPropertyFlags avoided;
+    } candidates[4] = {0};
+    uint32_t candidateCount = 0;
+
+#define WGVK_MEMORY_CANDIDATE(req, avoid) do { candidates[candidateCount].required = (req); candidates[candidateCount++].avoided = (avoid); } while (0)
+    if (usage & WGPUBufferUsage_MapRead) {
+        WGVK_MEMORY_CANDIDATE(hostMappable | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 0);
+        WGVK_MEMORY_CANDIDATE(hostMappable, 0);
+    }
+    else if (usage & WGPUBufferUsage_MapWrite) {
+        WGVK_MEMORY_CANDIDATE(hostMappable, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        WGVK_MEMORY_CANDIDATE(hostMappable, 0);
+    }
+    else if (usage & WGPUBufferUsage_Uniform) {
+        WGVK_MEMORY_CANDIDATE(hostMappable | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+        WGVK_MEMORY_CANDIDATE(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+        WGVK_MEMORY_CANDIDATE(0, 0);
+    }
+    else {
+        WGVK_MEMORY_CANDIDATE(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        WGVK_MEMORY_CANDIDATE(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+        WGVK_MEMORY_CANDIDATE(0, 0);
+    }
+#undef WGVK_MEMORY_CANDIDATE
+
+    for (uint32_t c = 0; c < candidateCount; c++) {
+        for (uint32_t i = 0; i < memoryProperties->memoryTypeCount; i++) {
+            const VkMemoryPropertyFlags flags = memoryProperties->memoryTypes[i].propertyFlags;
+            if (!((memoryTypeBits >> i) & 1)) continue;
+            if ((flags & candidates[c].required) != candidates[c].required) continue;
+            if (flags & (candidates[c].avoided | neverUse)) continue;
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
 static inline size_t wgpuStrlen(WGPUStringView ws) {
     if (ws.length == WGPU_STRLEN) {
         size_t i = 0;